@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/elementlibmanual"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/elementlibmanual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hexgrid.dir/bindings/oofemlib/hexgrid.C.o"
+  "CMakeFiles/hexgrid.dir/bindings/oofemlib/hexgrid.C.o.d"
+  "hexgrid"
+  "hexgrid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hexgrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/liboofem_benchmark.dir/src/main/benchmark.C.o"
+  "CMakeFiles/liboofem_benchmark.dir/src/main/benchmark.C.o.d"
+  "liboofem_benchmark"
+  "liboofem_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/liboofem_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oofem.dir/src/main/main.C.o"
+  "CMakeFiles/oofem.dir/src/main/main.C.o.d"
+  "oofem"
+  "oofem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oofem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+#define PRG_VERSION "OOFEM version 2.6"
+#define OOFEG_VERSION "OOFEG version 2.6"
+#define OOFEM_COPYRIGHT "Copyright (C) 1994-2017 Borek Patzak"
+
+#define PRG_HEADER_SM "\
+____________________________________________________\n\
+           OOFEM - Finite Element Solver\n\
+        Copyright (C) 1994-2017 Borek Patzak\n\
+____________________________________________________\n"
+
+#define PRG_HEADER "\
+############################################################## www.oofem.org ###\n\
+       ####    ####   ######  ######  #    #\n\
+     #    #  #    #  #       #       ##  ##\n\
+    #    #  #    #  #####   #####   # ## #\n\
+   #    #  #    #  #       #       #    #\n\
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6\n\
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak\n\
+################################################################################\n\n"
+
+#define HOST_TYPE "x86_64-Linux"
+#define HOST_NAME "vm"
+#define MODULE_LIST "tm;sm;dss;openmp"
+
+/* Headers */
+
+/* Define if execinfo.h defined */
+#define HAVE_EXECINFO_H 1
+
+/* Symbols */
+/* Define if cbrt is defined */
+#define HAVE_CBRT 1
+
+/* Define if isnan is defined */
+/* #undef HAVE_ISNAN */
+
+#include "oofem_export.h"
@@ -0,0 +1,252 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/oofemlib/activedof.C" "src/oofemlib/CMakeFiles/core.dir/activedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/activedof.C.o.d"
+  "/root/repo/src/oofemlib/assemblercallback.C" "src/oofemlib/CMakeFiles/core.dir/assemblercallback.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/assemblercallback.C.o.d"
+  "/root/repo/src/oofemlib/bctracker.C" "src/oofemlib/CMakeFiles/core.dir/bctracker.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/bctracker.C.o.d"
+  "/root/repo/src/oofemlib/boundarycondition.C" "src/oofemlib/CMakeFiles/core.dir/boundarycondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/boundarycondition.C.o.d"
+  "/root/repo/src/oofemlib/boundaryload.C" "src/oofemlib/CMakeFiles/core.dir/boundaryload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/boundaryload.C.o.d"
+  "/root/repo/src/oofemlib/calculatorfunction.C" "src/oofemlib/CMakeFiles/core.dir/calculatorfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/calculatorfunction.C.o.d"
+  "/root/repo/src/oofemlib/calmls.C" "src/oofemlib/CMakeFiles/core.dir/calmls.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/calmls.C.o.d"
+  "/root/repo/src/oofemlib/classfactory.C" "src/oofemlib/CMakeFiles/core.dir/classfactory.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/classfactory.C.o.d"
+  "/root/repo/src/oofemlib/cltypes.C" "src/oofemlib/CMakeFiles/core.dir/cltypes.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/cltypes.C.o.d"
+  "/root/repo/src/oofemlib/compcol.C" "src/oofemlib/CMakeFiles/core.dir/compcol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/compcol.C.o.d"
+  "/root/repo/src/oofemlib/connectivitytable.C" "src/oofemlib/CMakeFiles/core.dir/connectivitytable.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/connectivitytable.C.o.d"
+  "/root/repo/src/oofemlib/constantedgeload.C" "src/oofemlib/CMakeFiles/core.dir/constantedgeload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantedgeload.C.o.d"
+  "/root/repo/src/oofemlib/constantfunction.C" "src/oofemlib/CMakeFiles/core.dir/constantfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantfunction.C.o.d"
+  "/root/repo/src/oofemlib/constantsurfaceload.C" "src/oofemlib/CMakeFiles/core.dir/constantsurfaceload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantsurfaceload.C.o.d"
+  "/root/repo/src/oofemlib/contact/boundingvolumehierarchy.C" "src/oofemlib/CMakeFiles/core.dir/contact/boundingvolumehierarchy.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/contact/boundingvolumehierarchy.C.o.d"
+  "/root/repo/src/oofemlib/contact/contactdefinition.C" "src/oofemlib/CMakeFiles/core.dir/contact/contactdefinition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/contact/contactdefinition.C.o.d"
+  "/root/repo/src/oofemlib/contact/contactelement.C" "src/oofemlib/CMakeFiles/core.dir/contact/contactelement.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/contact/contactelement.C.o.d"
+  "/root/repo/src/oofemlib/contact/contactmanager.C" "src/oofemlib/CMakeFiles/core.dir/contact/contactmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/contact/contactmanager.C.o.d"
+  "/root/repo/src/oofemlib/crosssection.C" "src/oofemlib/CMakeFiles/core.dir/crosssection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/crosssection.C.o.d"
+  "/root/repo/src/oofemlib/datastream.C" "src/oofemlib/CMakeFiles/core.dir/datastream.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/datastream.C.o.d"
+  "/root/repo/src/oofemlib/deadweight.C" "src/oofemlib/CMakeFiles/core.dir/deadweight.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/deadweight.C.o.d"
+  "/root/repo/src/oofemlib/dictionary.C" "src/oofemlib/CMakeFiles/core.dir/dictionary.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dictionary.C.o.d"
+  "/root/repo/src/oofemlib/dof.C" "src/oofemlib/CMakeFiles/core.dir/dof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dof.C.o.d"
+  "/root/repo/src/oofemlib/dofdistributedprimaryfield.C" "src/oofemlib/CMakeFiles/core.dir/dofdistributedprimaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofdistributedprimaryfield.C.o.d"
+  "/root/repo/src/oofemlib/dofmanager.C" "src/oofemlib/CMakeFiles/core.dir/dofmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofmanager.C.o.d"
+  "/root/repo/src/oofemlib/dofmanvalfield.C" "src/oofemlib/CMakeFiles/core.dir/dofmanvalfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofmanvalfield.C.o.d"
+  "/root/repo/src/oofemlib/domain.C" "src/oofemlib/CMakeFiles/core.dir/domain.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/domain.C.o.d"
+  "/root/repo/src/oofemlib/dummylocalizer.C" "src/oofemlib/CMakeFiles/core.dir/dummylocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dummylocalizer.C.o.d"
+  "/root/repo/src/oofemlib/dummymaterial.C" "src/oofemlib/CMakeFiles/core.dir/dummymaterial.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dummymaterial.C.o.d"
+  "/root/repo/src/oofemlib/dynamicdatareader.C" "src/oofemlib/CMakeFiles/core.dir/dynamicdatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dynamicdatareader.C.o.d"
+  "/root/repo/src/oofemlib/dynamicinputrecord.C" "src/oofemlib/CMakeFiles/core.dir/dynamicinputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dynamicinputrecord.C.o.d"
+  "/root/repo/src/oofemlib/dynamicrelaxationsolver.C" "src/oofemlib/CMakeFiles/core.dir/dynamicrelaxationsolver.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dynamicrelaxationsolver.C.o.d"
+  "/root/repo/src/oofemlib/eigenvectorprimaryfield.C" "src/oofemlib/CMakeFiles/core.dir/eigenvectorprimaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/eigenvectorprimaryfield.C.o.d"
+  "/root/repo/src/oofemlib/element.C" "src/oofemlib/CMakeFiles/core.dir/element.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/element.C.o.d"
+  "/root/repo/src/oofemlib/elementinternaldofman.C" "src/oofemlib/CMakeFiles/core.dir/elementinternaldofman.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/elementinternaldofman.C.o.d"
+  "/root/repo/src/oofemlib/elementside.C" "src/oofemlib/CMakeFiles/core.dir/elementside.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/elementside.C.o.d"
+  "/root/repo/src/oofemlib/eleminterpunknownmapper.C" "src/oofemlib/CMakeFiles/core.dir/eleminterpunknownmapper.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/eleminterpunknownmapper.C.o.d"
+  "/root/repo/src/oofemlib/emptycs.C" "src/oofemlib/CMakeFiles/core.dir/emptycs.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/emptycs.C.o.d"
+  "/root/repo/src/oofemlib/engngm.C" "src/oofemlib/CMakeFiles/core.dir/engngm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/engngm.C.o.d"
+  "/root/repo/src/oofemlib/error.C" "src/oofemlib/CMakeFiles/core.dir/error.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/error.C.o.d"
+  "/root/repo/src/oofemlib/errorcheckingexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/errorcheckingexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/errorcheckingexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/errorestimator.C" "src/oofemlib/CMakeFiles/core.dir/errorestimator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/errorestimator.C.o.d"
+  "/root/repo/src/oofemlib/exportmodule.C" "src/oofemlib/CMakeFiles/core.dir/exportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/exportmodule.C.o.d"
+  "/root/repo/src/oofemlib/exportmodulemanager.C" "src/oofemlib/CMakeFiles/core.dir/exportmodulemanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/exportmodulemanager.C.o.d"
+  "/root/repo/src/oofemlib/fei1dhermite.C" "src/oofemlib/CMakeFiles/core.dir/fei1dhermite.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dhermite.C.o.d"
+  "/root/repo/src/oofemlib/fei1dlin.C" "src/oofemlib/CMakeFiles/core.dir/fei1dlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dlin.C.o.d"
+  "/root/repo/src/oofemlib/fei1dquad.C" "src/oofemlib/CMakeFiles/core.dir/fei1dquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinehermite.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinehermite.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinehermite.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinelin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinelin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinequad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinequad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinequad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadbiquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadbiquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadbiquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadconst.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadconst.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadconst.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadlin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadlin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dtrlin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dtrlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dtrlin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dtrquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dtrquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dtrquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexalin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexalin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexalin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexaquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexaquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexaquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexatriquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexatriquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexatriquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dlinelin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dlinelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dlinelin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtetlin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtetlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtetlin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtetquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtetquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtetquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtrlin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtrlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtrlin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtrquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtrquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtrquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dwedgelin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgelin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dwedgequad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgequad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgequad.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol1d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol1d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol1d.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol2d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol2d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol2d.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol3d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol3d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol3d.C.o.d"
+  "/root/repo/src/oofemlib/femcmpnn.C" "src/oofemlib/CMakeFiles/core.dir/femcmpnn.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/femcmpnn.C.o.d"
+  "/root/repo/src/oofemlib/field.C" "src/oofemlib/CMakeFiles/core.dir/field.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/field.C.o.d"
+  "/root/repo/src/oofemlib/fieldmanager.C" "src/oofemlib/CMakeFiles/core.dir/fieldmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fieldmanager.C.o.d"
+  "/root/repo/src/oofemlib/floatarray.C" "src/oofemlib/CMakeFiles/core.dir/floatarray.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/floatarray.C.o.d"
+  "/root/repo/src/oofemlib/floatmatrix.C" "src/oofemlib/CMakeFiles/core.dir/floatmatrix.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/floatmatrix.C.o.d"
+  "/root/repo/src/oofemlib/fracturemanager.C" "src/oofemlib/CMakeFiles/core.dir/fracturemanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fracturemanager.C.o.d"
+  "/root/repo/src/oofemlib/freeminterface.C" "src/oofemlib/CMakeFiles/core.dir/freeminterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/freeminterface.C.o.d"
+  "/root/repo/src/oofemlib/function.C" "src/oofemlib/CMakeFiles/core.dir/function.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/function.C.o.d"
+  "/root/repo/src/oofemlib/gaussintegrationrule.C" "src/oofemlib/CMakeFiles/core.dir/gaussintegrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gaussintegrationrule.C.o.d"
+  "/root/repo/src/oofemlib/gausspoint.C" "src/oofemlib/CMakeFiles/core.dir/gausspoint.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gausspoint.C.o.d"
+  "/root/repo/src/oofemlib/generalboundarycondition.C" "src/oofemlib/CMakeFiles/core.dir/generalboundarycondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/generalboundarycondition.C.o.d"
+  "/root/repo/src/oofemlib/geometry.C" "src/oofemlib/CMakeFiles/core.dir/geometry.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/geometry.C.o.d"
+  "/root/repo/src/oofemlib/geotoolbox.C" "src/oofemlib/CMakeFiles/core.dir/geotoolbox.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/geotoolbox.C.o.d"
+  "/root/repo/src/oofemlib/gjacobi.C" "src/oofemlib/CMakeFiles/core.dir/gjacobi.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gjacobi.C.o.d"
+  "/root/repo/src/oofemlib/gpexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/gpexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gpexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/grid.C" "src/oofemlib/CMakeFiles/core.dir/grid.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/grid.C.o.d"
+  "/root/repo/src/oofemlib/hangingnode.C" "src/oofemlib/CMakeFiles/core.dir/hangingnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/hangingnode.C.o.d"
+  "/root/repo/src/oofemlib/heap.C" "src/oofemlib/CMakeFiles/core.dir/heap.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/heap.C.o.d"
+  "/root/repo/src/oofemlib/heavisidetimefunction.C" "src/oofemlib/CMakeFiles/core.dir/heavisidetimefunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/heavisidetimefunction.C.o.d"
+  "/root/repo/src/oofemlib/homexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/homexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/homexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/homogenize.C" "src/oofemlib/CMakeFiles/core.dir/homogenize.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/homogenize.C.o.d"
+  "/root/repo/src/oofemlib/iga/feibspline.C" "src/oofemlib/CMakeFiles/core.dir/iga/feibspline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feibspline.C.o.d"
+  "/root/repo/src/oofemlib/iga/feinurbs.C" "src/oofemlib/CMakeFiles/core.dir/iga/feinurbs.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feinurbs.C.o.d"
+  "/root/repo/src/oofemlib/iga/feitspline.C" "src/oofemlib/CMakeFiles/core.dir/iga/feitspline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feitspline.C.o.d"
+  "/root/repo/src/oofemlib/iga/iga.C" "src/oofemlib/CMakeFiles/core.dir/iga/iga.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/iga.C.o.d"
+  "/root/repo/src/oofemlib/initialcondition.C" "src/oofemlib/CMakeFiles/core.dir/initialcondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initialcondition.C.o.d"
+  "/root/repo/src/oofemlib/initmodule.C" "src/oofemlib/CMakeFiles/core.dir/initmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initmodule.C.o.d"
+  "/root/repo/src/oofemlib/initmodulemanager.C" "src/oofemlib/CMakeFiles/core.dir/initmodulemanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initmodulemanager.C.o.d"
+  "/root/repo/src/oofemlib/inputrecord.C" "src/oofemlib/CMakeFiles/core.dir/inputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/inputrecord.C.o.d"
+  "/root/repo/src/oofemlib/intarray.C" "src/oofemlib/CMakeFiles/core.dir/intarray.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/intarray.C.o.d"
+  "/root/repo/src/oofemlib/integrationrule.C" "src/oofemlib/CMakeFiles/core.dir/integrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/integrationrule.C.o.d"
+  "/root/repo/src/oofemlib/interpolatingfunction.C" "src/oofemlib/CMakeFiles/core.dir/interpolatingfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/interpolatingfunction.C.o.d"
+  "/root/repo/src/oofemlib/intvarfield.C" "src/oofemlib/CMakeFiles/core.dir/intvarfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/intvarfield.C.o.d"
+  "/root/repo/src/oofemlib/inverseit.C" "src/oofemlib/CMakeFiles/core.dir/inverseit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/inverseit.C.o.d"
+  "/root/repo/src/oofemlib/lanczosit.C" "src/oofemlib/CMakeFiles/core.dir/lanczosit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/lanczosit.C.o.d"
+  "/root/repo/src/oofemlib/latticedirichletcouplingnode.C" "src/oofemlib/CMakeFiles/core.dir/latticedirichletcouplingnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/latticedirichletcouplingnode.C.o.d"
+  "/root/repo/src/oofemlib/latticeneumanncouplingnode.C" "src/oofemlib/CMakeFiles/core.dir/latticeneumanncouplingnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/latticeneumanncouplingnode.C.o.d"
+  "/root/repo/src/oofemlib/ldltfact.C" "src/oofemlib/CMakeFiles/core.dir/ldltfact.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/ldltfact.C.o.d"
+  "/root/repo/src/oofemlib/linearconstraintbc.C" "src/oofemlib/CMakeFiles/core.dir/linearconstraintbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linearconstraintbc.C.o.d"
+  "/root/repo/src/oofemlib/linearedgeload.C" "src/oofemlib/CMakeFiles/core.dir/linearedgeload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linearedgeload.C.o.d"
+  "/root/repo/src/oofemlib/linesearch.C" "src/oofemlib/CMakeFiles/core.dir/linesearch.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linesearch.C.o.d"
+  "/root/repo/src/oofemlib/load.C" "src/oofemlib/CMakeFiles/core.dir/load.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/load.C.o.d"
+  "/root/repo/src/oofemlib/loadbalancer.C" "src/oofemlib/CMakeFiles/core.dir/loadbalancer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/loadbalancer.C.o.d"
+  "/root/repo/src/oofemlib/lobattoir.C" "src/oofemlib/CMakeFiles/core.dir/lobattoir.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/lobattoir.C.o.d"
+  "/root/repo/src/oofemlib/localgaussianrandomfunction.C" "src/oofemlib/CMakeFiles/core.dir/localgaussianrandomfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/localgaussianrandomfunction.C.o.d"
+  "/root/repo/src/oofemlib/logger.C" "src/oofemlib/CMakeFiles/core.dir/logger.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/logger.C.o.d"
+  "/root/repo/src/oofemlib/maskedprimaryfield.C" "src/oofemlib/CMakeFiles/core.dir/maskedprimaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/maskedprimaryfield.C.o.d"
+  "/root/repo/src/oofemlib/masterdof.C" "src/oofemlib/CMakeFiles/core.dir/masterdof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/masterdof.C.o.d"
+  "/root/repo/src/oofemlib/masterdofpool.C" "src/oofemlib/CMakeFiles/core.dir/masterdofpool.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/masterdofpool.C.o.d"
+  "/root/repo/src/oofemlib/material.C" "src/oofemlib/CMakeFiles/core.dir/material.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/material.C.o.d"
+  "/root/repo/src/oofemlib/materialmappingalgorithm.C" "src/oofemlib/CMakeFiles/core.dir/materialmappingalgorithm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/materialmappingalgorithm.C.o.d"
+  "/root/repo/src/oofemlib/mathfem.C" "src/oofemlib/CMakeFiles/core.dir/mathfem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mathfem.C.o.d"
+  "/root/repo/src/oofemlib/matlabexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/matlabexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/matlabexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/matstatmapperint.C" "src/oofemlib/CMakeFiles/core.dir/matstatmapperint.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/matstatmapperint.C.o.d"
+  "/root/repo/src/oofemlib/memoryusage.C" "src/oofemlib/CMakeFiles/core.dir/memoryusage.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/memoryusage.C.o.d"
+  "/root/repo/src/oofemlib/meshqualityerrorestimator.C" "src/oofemlib/CMakeFiles/core.dir/meshqualityerrorestimator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/meshqualityerrorestimator.C.o.d"
+  "/root/repo/src/oofemlib/metastep.C" "src/oofemlib/CMakeFiles/core.dir/metastep.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/metastep.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressurebc.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressurebc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressurebc.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressuredirichlet.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressureneumann.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureneumann.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureneumann.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressureweakperiodic.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o.d"
+  "/root/repo/src/oofemlib/mmaclosestiptransfer.C" "src/oofemlib/CMakeFiles/core.dir/mmaclosestiptransfer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmaclosestiptransfer.C.o.d"
+  "/root/repo/src/oofemlib/mmacontainingelementprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmacontainingelementprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmacontainingelementprojection.C.o.d"
+  "/root/repo/src/oofemlib/mmaleastsquareprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmaleastsquareprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmaleastsquareprojection.C.o.d"
+  "/root/repo/src/oofemlib/mmashapefunctprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmashapefunctprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmashapefunctprojection.C.o.d"
+  "/root/repo/src/oofemlib/monitor.C" "src/oofemlib/CMakeFiles/core.dir/monitor.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/monitor.C.o.d"
+  "/root/repo/src/oofemlib/monitormanager.C" "src/oofemlib/CMakeFiles/core.dir/monitormanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/monitormanager.C.o.d"
+  "/root/repo/src/oofemlib/neumannmomentload.C" "src/oofemlib/CMakeFiles/core.dir/neumannmomentload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/neumannmomentload.C.o.d"
+  "/root/repo/src/oofemlib/nodalaveragingrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/nodalload.C" "src/oofemlib/CMakeFiles/core.dir/nodalload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalload.C.o.d"
+  "/root/repo/src/oofemlib/nodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/nodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/node.C" "src/oofemlib/CMakeFiles/core.dir/node.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/node.C.o.d"
+  "/root/repo/src/oofemlib/nonlocalbarrier.C" "src/oofemlib/CMakeFiles/core.dir/nonlocalbarrier.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nonlocalbarrier.C.o.d"
+  "/root/repo/src/oofemlib/nonlocalmaterialext.C" "src/oofemlib/CMakeFiles/core.dir/nonlocalmaterialext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nonlocalmaterialext.C.o.d"
+  "/root/repo/src/oofemlib/nrsolver.C" "src/oofemlib/CMakeFiles/core.dir/nrsolver.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nrsolver.C.o.d"
+  "/root/repo/src/oofemlib/octreelocalizer.C" "src/oofemlib/CMakeFiles/core.dir/octreelocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/octreelocalizer.C.o.d"
+  "/root/repo/src/oofemlib/oofemtxtdatareader.C" "src/oofemlib/CMakeFiles/core.dir/oofemtxtdatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofemtxtdatareader.C.o.d"
+  "/root/repo/src/oofemlib/oofemtxtinputrecord.C" "src/oofemlib/CMakeFiles/core.dir/oofemtxtinputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofemtxtinputrecord.C.o.d"
+  "/root/repo/src/oofemlib/outputexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/outputexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/outputexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/outputmanager.C" "src/oofemlib/CMakeFiles/core.dir/outputmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/outputmanager.C.o.d"
+  "/root/repo/src/oofemlib/parallelcontext.C" "src/oofemlib/CMakeFiles/core.dir/parallelcontext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/parallelcontext.C.o.d"
+  "/root/repo/src/oofemlib/parser.C" "src/oofemlib/CMakeFiles/core.dir/parser.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/parser.C.o.d"
+  "/root/repo/src/oofemlib/peakfunction.C" "src/oofemlib/CMakeFiles/core.dir/peakfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/peakfunction.C.o.d"
+  "/root/repo/src/oofemlib/periodicpiecewiselinfunction.C" "src/oofemlib/CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o.d"
+  "/root/repo/src/oofemlib/piecewiselinfunction.C" "src/oofemlib/CMakeFiles/core.dir/piecewiselinfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/piecewiselinfunction.C.o.d"
+  "/root/repo/src/oofemlib/pointload.C" "src/oofemlib/CMakeFiles/core.dir/pointload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/pointload.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradient.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradient.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradient.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradientbcneumann.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcneumann.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcneumann.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradientbcperiodic.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcperiodic.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcperiodic.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradientbcweak.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweak.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweak.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradientbcweakdirichlet.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweakdirichlet.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweakdirichlet.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradientbcweakperiodic.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweakperiodic.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradientbcweakperiodic.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradienthomogenization.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradienthomogenization.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradienthomogenization.C.o.d"
+  "/root/repo/src/oofemlib/prescribedmean.C" "src/oofemlib/CMakeFiles/core.dir/prescribedmean.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedmean.C.o.d"
+  "/root/repo/src/oofemlib/primaryfield.C" "src/oofemlib/CMakeFiles/core.dir/primaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/primaryfield.C.o.d"
+  "/root/repo/src/oofemlib/primaryunknownmapper.C" "src/oofemlib/CMakeFiles/core.dir/primaryunknownmapper.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/primaryunknownmapper.C.o.d"
+  "/root/repo/src/oofemlib/profilerexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/profilerexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/profilerexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/qcnode.C" "src/oofemlib/CMakeFiles/core.dir/qcnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/qcnode.C.o.d"
+  "/root/repo/src/oofemlib/randommaterialext.C" "src/oofemlib/CMakeFiles/core.dir/randommaterialext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/randommaterialext.C.o.d"
+  "/root/repo/src/oofemlib/reinforcement.C" "src/oofemlib/CMakeFiles/core.dir/reinforcement.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/reinforcement.C.o.d"
+  "/root/repo/src/oofemlib/remeshingcrit.C" "src/oofemlib/CMakeFiles/core.dir/remeshingcrit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/remeshingcrit.C.o.d"
+  "/root/repo/src/oofemlib/rigidarmnode.C" "src/oofemlib/CMakeFiles/core.dir/rigidarmnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/rigidarmnode.C.o.d"
+  "/root/repo/src/oofemlib/rowcol.C" "src/oofemlib/CMakeFiles/core.dir/rowcol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/rowcol.C.o.d"
+  "/root/repo/src/oofemlib/scalarfunction.C" "src/oofemlib/CMakeFiles/core.dir/scalarfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/scalarfunction.C.o.d"
+  "/root/repo/src/oofemlib/set.C" "src/oofemlib/CMakeFiles/core.dir/set.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/set.C.o.d"
+  "/root/repo/src/oofemlib/simpleslavedof.C" "src/oofemlib/CMakeFiles/core.dir/simpleslavedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/simpleslavedof.C.o.d"
+  "/root/repo/src/oofemlib/skyline.C" "src/oofemlib/CMakeFiles/core.dir/skyline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/skyline.C.o.d"
+  "/root/repo/src/oofemlib/skylineu.C" "src/oofemlib/CMakeFiles/core.dir/skylineu.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/skylineu.C.o.d"
+  "/root/repo/src/oofemlib/slavedof.C" "src/oofemlib/CMakeFiles/core.dir/slavedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/slavedof.C.o.d"
+  "/root/repo/src/oofemlib/slavenode.C" "src/oofemlib/CMakeFiles/core.dir/slavenode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/slavenode.C.o.d"
+  "/root/repo/src/oofemlib/sloangraph.C" "src/oofemlib/CMakeFiles/core.dir/sloangraph.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloangraph.C.o.d"
+  "/root/repo/src/oofemlib/sloangraphnode.C" "src/oofemlib/CMakeFiles/core.dir/sloangraphnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloangraphnode.C.o.d"
+  "/root/repo/src/oofemlib/sloanlevelstruct.C" "src/oofemlib/CMakeFiles/core.dir/sloanlevelstruct.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloanlevelstruct.C.o.d"
+  "/root/repo/src/oofemlib/smoothednodalintvarfield.C" "src/oofemlib/CMakeFiles/core.dir/smoothednodalintvarfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/smoothednodalintvarfield.C.o.d"
+  "/root/repo/src/oofemlib/solutionbasedshapefunction.C" "src/oofemlib/CMakeFiles/core.dir/solutionbasedshapefunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/solutionbasedshapefunction.C.o.d"
+  "/root/repo/src/oofemlib/sparselinsystemnm.C" "src/oofemlib/CMakeFiles/core.dir/sparselinsystemnm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sparselinsystemnm.C.o.d"
+  "/root/repo/src/oofemlib/sparsenonlinsystemnm.C" "src/oofemlib/CMakeFiles/core.dir/sparsenonlinsystemnm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sparsenonlinsystemnm.C.o.d"
+  "/root/repo/src/oofemlib/spatiallocalizer.C" "src/oofemlib/CMakeFiles/core.dir/spatiallocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/spatiallocalizer.C.o.d"
+  "/root/repo/src/oofemlib/sprnodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/sprnodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sprnodalrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/staggeredproblem.C" "src/oofemlib/CMakeFiles/core.dir/staggeredproblem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/staggeredproblem.C.o.d"
+  "/root/repo/src/oofemlib/staggeredsolver.C" "src/oofemlib/CMakeFiles/core.dir/staggeredsolver.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/staggeredsolver.C.o.d"
+  "/root/repo/src/oofemlib/subdivision.C" "src/oofemlib/CMakeFiles/core.dir/subdivision.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/subdivision.C.o.d"
+  "/root/repo/src/oofemlib/subspaceit.C" "src/oofemlib/CMakeFiles/core.dir/subspaceit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/subspaceit.C.o.d"
+  "/root/repo/src/oofemlib/surfacetensionbc.C" "src/oofemlib/CMakeFiles/core.dir/surfacetensionbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/surfacetensionbc.C.o.d"
+  "/root/repo/src/oofemlib/symcompcol.C" "src/oofemlib/CMakeFiles/core.dir/symcompcol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/symcompcol.C.o.d"
+  "/root/repo/src/oofemlib/t3dinterface.C" "src/oofemlib/CMakeFiles/core.dir/t3dinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/t3dinterface.C.o.d"
+  "/root/repo/src/oofemlib/targe2interface.C" "src/oofemlib/CMakeFiles/core.dir/targe2interface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/targe2interface.C.o.d"
+  "/root/repo/src/oofemlib/timer.C" "src/oofemlib/CMakeFiles/core.dir/timer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/timer.C.o.d"
+  "/root/repo/src/oofemlib/timestep.C" "src/oofemlib/CMakeFiles/core.dir/timestep.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/timestep.C.o.d"
+  "/root/repo/src/oofemlib/tokenizer.C" "src/oofemlib/CMakeFiles/core.dir/tokenizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/tokenizer.C.o.d"
+  "/root/repo/src/oofemlib/trianglemesherinterface.C" "src/oofemlib/CMakeFiles/core.dir/trianglemesherinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/trianglemesherinterface.C.o.d"
+  "/root/repo/src/oofemlib/uniformgridfield.C" "src/oofemlib/CMakeFiles/core.dir/uniformgridfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/uniformgridfield.C.o.d"
+  "/root/repo/src/oofemlib/unstructuredgridfield.C" "src/oofemlib/CMakeFiles/core.dir/unstructuredgridfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/unstructuredgridfield.C.o.d"
+  "/root/repo/src/oofemlib/util.C" "src/oofemlib/CMakeFiles/core.dir/util.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/util.C.o.d"
+  "/root/repo/src/oofemlib/vtkexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/vtkxmlexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkxmlexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkxmlexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/vtkxmllatticeexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkxmllatticeexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkxmllatticeexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/vtkxmlperiodicexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkxmlperiodicexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkxmlperiodicexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/weakperiodicbc.C" "src/oofemlib/CMakeFiles/core.dir/weakperiodicbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/weakperiodicbc.C.o.d"
+  "/root/repo/src/oofemlib/xfem/XFEMDebugTools.C" "src/oofemlib/CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o.d"
+  "/root/repo/src/oofemlib/xfem/delaunay.C" "src/oofemlib/CMakeFiles/core.dir/xfem/delaunay.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/delaunay.C.o.d"
+  "/root/repo/src/oofemlib/xfem/directei.C" "src/oofemlib/CMakeFiles/core.dir/xfem/directei.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/directei.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfront.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfront.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfront.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontcohesivebranchfunconeel.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontcohesivebranchfunconeel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontcohesivebranchfunconeel.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontdonothing.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontdonothing.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontdonothing.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontextend.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontextend.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontextend.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontintersection.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontintersection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontintersection.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontlinbranchfunconeel.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontlinbranchfunconeel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontlinbranchfunconeel.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontlinbranchfuncradius.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontlinbranchfuncradius.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontlinbranchfuncradius.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfronts/enrichmentfrontreducefront.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontreducefront.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfronts/enrichmentfrontreducefront.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfunction.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfunction.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentitem.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentitem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentitem.C.o.d"
+  "/root/repo/src/oofemlib/xfem/geometrybasedei.C" "src/oofemlib/CMakeFiles/core.dir/xfem/geometrybasedei.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/geometrybasedei.C.o.d"
+  "/root/repo/src/oofemlib/xfem/hybridei.C" "src/oofemlib/CMakeFiles/core.dir/xfem/hybridei.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/hybridei.C.o.d"
+  "/root/repo/src/oofemlib/xfem/inclusion.C" "src/oofemlib/CMakeFiles/core.dir/xfem/inclusion.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/inclusion.C.o.d"
+  "/root/repo/src/oofemlib/xfem/integrationrules/discsegintegrationrule.C" "src/oofemlib/CMakeFiles/core.dir/xfem/integrationrules/discsegintegrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/integrationrules/discsegintegrationrule.C.o.d"
+  "/root/repo/src/oofemlib/xfem/listbasedei.C" "src/oofemlib/CMakeFiles/core.dir/xfem/listbasedei.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/listbasedei.C.o.d"
+  "/root/repo/src/oofemlib/xfem/nucleationcriterion.C" "src/oofemlib/CMakeFiles/core.dir/xfem/nucleationcriterion.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/nucleationcriterion.C.o.d"
+  "/root/repo/src/oofemlib/xfem/patchintegrationrule.C" "src/oofemlib/CMakeFiles/core.dir/xfem/patchintegrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/patchintegrationrule.C.o.d"
+  "/root/repo/src/oofemlib/xfem/propagationlaw.C" "src/oofemlib/CMakeFiles/core.dir/xfem/propagationlaw.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/propagationlaw.C.o.d"
+  "/root/repo/src/oofemlib/xfem/xfemelementinterface.C" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemelementinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemelementinterface.C.o.d"
+  "/root/repo/src/oofemlib/xfem/xfemmanager.C" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemmanager.C.o.d"
+  "/root/repo/src/oofemlib/xfem/xfemtolerances.C" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemtolerances.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemtolerances.C.o.d"
+  "/root/repo/src/oofemlib/zznodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/zznodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/zznodalrecoverymodel.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
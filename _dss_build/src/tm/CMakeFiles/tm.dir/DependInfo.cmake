@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tm/BoundaryCondition/gravitypressure.C" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/gravitypressure.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/gravitypressure.C.o.d"
+  "/root/repo/src/tm/BoundaryCondition/transportgradientdirichlet.C" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientdirichlet.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientdirichlet.C.o.d"
+  "/root/repo/src/tm/BoundaryCondition/transportgradientneumann.C" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientneumann.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientneumann.C.o.d"
+  "/root/repo/src/tm/BoundaryCondition/transportgradientperiodic.C" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientperiodic.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/BoundaryCondition/transportgradientperiodic.C.o.d"
+  "/root/repo/src/tm/Elements/LatticeElements/lattice2d_mt.C" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/lattice2d_mt.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/lattice2d_mt.C.o.d"
+  "/root/repo/src/tm/Elements/LatticeElements/lattice3d_mt.C" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/lattice3d_mt.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/lattice3d_mt.C.o.d"
+  "/root/repo/src/tm/Elements/LatticeElements/latticetransportelement.C" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/latticetransportelement.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/LatticeElements/latticetransportelement.C.o.d"
+  "/root/repo/src/tm/Elements/brick1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/brick1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/brick1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/qbrick1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/qbrick1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/qbrick1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/qquad1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/qquad1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/qquad1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/quad1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/quad1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/quad1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/quadaxisym1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/quadaxisym1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/quadaxisym1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/qwedge_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/qwedge_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/qwedge_ht.C.o.d"
+  "/root/repo/src/tm/Elements/tetrah1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/tetrah1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/tetrah1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/tr1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/tr1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/tr1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/tr1darcy.C" "src/tm/CMakeFiles/tm.dir/Elements/tr1darcy.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/tr1darcy.C.o.d"
+  "/root/repo/src/tm/Elements/transportelement.C" "src/tm/CMakeFiles/tm.dir/Elements/transportelement.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/transportelement.C.o.d"
+  "/root/repo/src/tm/Elements/traxisym1_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/traxisym1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/traxisym1_ht.C.o.d"
+  "/root/repo/src/tm/Elements/wedge_ht.C" "src/tm/CMakeFiles/tm.dir/Elements/wedge_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Elements/wedge_ht.C.o.d"
+  "/root/repo/src/tm/EngineeringModels/nltransienttransportproblem.C" "src/tm/CMakeFiles/tm.dir/EngineeringModels/nltransienttransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/EngineeringModels/nltransienttransportproblem.C.o.d"
+  "/root/repo/src/tm/EngineeringModels/nonstationarytransportproblem.C" "src/tm/CMakeFiles/tm.dir/EngineeringModels/nonstationarytransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/EngineeringModels/nonstationarytransportproblem.C.o.d"
+  "/root/repo/src/tm/EngineeringModels/stationarytransportproblem.C" "src/tm/CMakeFiles/tm.dir/EngineeringModels/stationarytransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/EngineeringModels/stationarytransportproblem.C.o.d"
+  "/root/repo/src/tm/EngineeringModels/transienttransportproblem.C" "src/tm/CMakeFiles/tm.dir/EngineeringModels/transienttransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/EngineeringModels/transienttransportproblem.C.o.d"
+  "/root/repo/src/tm/Materials/LatticeMaterials/latticetransmat.C" "src/tm/CMakeFiles/tm.dir/Materials/LatticeMaterials/latticetransmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/LatticeMaterials/latticetransmat.C.o.d"
+  "/root/repo/src/tm/Materials/anisomassmat.C" "src/tm/CMakeFiles/tm.dir/Materials/anisomassmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/anisomassmat.C.o.d"
+  "/root/repo/src/tm/Materials/bazantnajjarmat.C" "src/tm/CMakeFiles/tm.dir/Materials/bazantnajjarmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/bazantnajjarmat.C.o.d"
+  "/root/repo/src/tm/Materials/hemobaznajmat.C" "src/tm/CMakeFiles/tm.dir/Materials/hemobaznajmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hemobaznajmat.C.o.d"
+  "/root/repo/src/tm/Materials/hemokunzelmat.C" "src/tm/CMakeFiles/tm.dir/Materials/hemokunzelmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hemokunzelmat.C.o.d"
+  "/root/repo/src/tm/Materials/hemotkmat.C" "src/tm/CMakeFiles/tm.dir/Materials/hemotkmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hemotkmat.C.o.d"
+  "/root/repo/src/tm/Materials/hydram.C" "src/tm/CMakeFiles/tm.dir/Materials/hydram.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hydram.C.o.d"
+  "/root/repo/src/tm/Materials/hydratingconcretemat.C" "src/tm/CMakeFiles/tm.dir/Materials/hydratingconcretemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hydratingconcretemat.C.o.d"
+  "/root/repo/src/tm/Materials/hydratinghemomat.C" "src/tm/CMakeFiles/tm.dir/Materials/hydratinghemomat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hydratinghemomat.C.o.d"
+  "/root/repo/src/tm/Materials/hydratingisoheatmat.C" "src/tm/CMakeFiles/tm.dir/Materials/hydratingisoheatmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/hydratingisoheatmat.C.o.d"
+  "/root/repo/src/tm/Materials/isoheatmat.C" "src/tm/CMakeFiles/tm.dir/Materials/isoheatmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/isoheatmat.C.o.d"
+  "/root/repo/src/tm/Materials/isolinmoisturemat.C" "src/tm/CMakeFiles/tm.dir/Materials/isolinmoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/isolinmoisturemat.C.o.d"
+  "/root/repo/src/tm/Materials/isomoisturemat.C" "src/tm/CMakeFiles/tm.dir/Materials/isomoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/isomoisturemat.C.o.d"
+  "/root/repo/src/tm/Materials/nlisomoisturemat.C" "src/tm/CMakeFiles/tm.dir/Materials/nlisomoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/nlisomoisturemat.C.o.d"
+  "/root/repo/src/tm/Materials/nonlinearmassmat.C" "src/tm/CMakeFiles/tm.dir/Materials/nonlinearmassmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/nonlinearmassmat.C.o.d"
+  "/root/repo/src/tm/Materials/rvestokesflow.C" "src/tm/CMakeFiles/tm.dir/Materials/rvestokesflow.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/rvestokesflow.C.o.d"
+  "/root/repo/src/tm/Materials/transportmaterial.C" "src/tm/CMakeFiles/tm.dir/Materials/transportmaterial.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/transportmaterial.C.o.d"
+  "/root/repo/src/tm/Materials/twophasemat.C" "src/tm/CMakeFiles/tm.dir/Materials/twophasemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/Materials/twophasemat.C.o.d"
+  "/root/repo/src/tm/simpletransportcrosssection.C" "src/tm/CMakeFiles/tm.dir/simpletransportcrosssection.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/simpletransportcrosssection.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
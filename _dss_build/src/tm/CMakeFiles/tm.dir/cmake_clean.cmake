@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tm.dir/BoundaryCondition/gravitypressure.C.o"
+  "CMakeFiles/tm.dir/BoundaryCondition/gravitypressure.C.o.d"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientdirichlet.C.o"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientdirichlet.C.o.d"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientneumann.C.o"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientneumann.C.o.d"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientperiodic.C.o"
+  "CMakeFiles/tm.dir/BoundaryCondition/transportgradientperiodic.C.o.d"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/lattice2d_mt.C.o"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/lattice2d_mt.C.o.d"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/lattice3d_mt.C.o"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/lattice3d_mt.C.o.d"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/latticetransportelement.C.o"
+  "CMakeFiles/tm.dir/Elements/LatticeElements/latticetransportelement.C.o.d"
+  "CMakeFiles/tm.dir/Elements/brick1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/brick1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/qbrick1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/qbrick1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/qquad1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/qquad1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/quad1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/quad1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/quadaxisym1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/quadaxisym1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/qwedge_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/qwedge_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/tetrah1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/tetrah1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/tr1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/tr1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/tr1darcy.C.o"
+  "CMakeFiles/tm.dir/Elements/tr1darcy.C.o.d"
+  "CMakeFiles/tm.dir/Elements/transportelement.C.o"
+  "CMakeFiles/tm.dir/Elements/transportelement.C.o.d"
+  "CMakeFiles/tm.dir/Elements/traxisym1_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/traxisym1_ht.C.o.d"
+  "CMakeFiles/tm.dir/Elements/wedge_ht.C.o"
+  "CMakeFiles/tm.dir/Elements/wedge_ht.C.o.d"
+  "CMakeFiles/tm.dir/EngineeringModels/nltransienttransportproblem.C.o"
+  "CMakeFiles/tm.dir/EngineeringModels/nltransienttransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/EngineeringModels/nonstationarytransportproblem.C.o"
+  "CMakeFiles/tm.dir/EngineeringModels/nonstationarytransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/EngineeringModels/stationarytransportproblem.C.o"
+  "CMakeFiles/tm.dir/EngineeringModels/stationarytransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/EngineeringModels/transienttransportproblem.C.o"
+  "CMakeFiles/tm.dir/EngineeringModels/transienttransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/Materials/LatticeMaterials/latticetransmat.C.o"
+  "CMakeFiles/tm.dir/Materials/LatticeMaterials/latticetransmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/anisomassmat.C.o"
+  "CMakeFiles/tm.dir/Materials/anisomassmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/bazantnajjarmat.C.o"
+  "CMakeFiles/tm.dir/Materials/bazantnajjarmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hemobaznajmat.C.o"
+  "CMakeFiles/tm.dir/Materials/hemobaznajmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hemokunzelmat.C.o"
+  "CMakeFiles/tm.dir/Materials/hemokunzelmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hemotkmat.C.o"
+  "CMakeFiles/tm.dir/Materials/hemotkmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hydram.C.o"
+  "CMakeFiles/tm.dir/Materials/hydram.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hydratingconcretemat.C.o"
+  "CMakeFiles/tm.dir/Materials/hydratingconcretemat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hydratinghemomat.C.o"
+  "CMakeFiles/tm.dir/Materials/hydratinghemomat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/hydratingisoheatmat.C.o"
+  "CMakeFiles/tm.dir/Materials/hydratingisoheatmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/isoheatmat.C.o"
+  "CMakeFiles/tm.dir/Materials/isoheatmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/isolinmoisturemat.C.o"
+  "CMakeFiles/tm.dir/Materials/isolinmoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/isomoisturemat.C.o"
+  "CMakeFiles/tm.dir/Materials/isomoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/nlisomoisturemat.C.o"
+  "CMakeFiles/tm.dir/Materials/nlisomoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/nonlinearmassmat.C.o"
+  "CMakeFiles/tm.dir/Materials/nonlinearmassmat.C.o.d"
+  "CMakeFiles/tm.dir/Materials/rvestokesflow.C.o"
+  "CMakeFiles/tm.dir/Materials/rvestokesflow.C.o.d"
+  "CMakeFiles/tm.dir/Materials/transportmaterial.C.o"
+  "CMakeFiles/tm.dir/Materials/transportmaterial.C.o.d"
+  "CMakeFiles/tm.dir/Materials/twophasemat.C.o"
+  "CMakeFiles/tm.dir/Materials/twophasemat.C.o.d"
+  "CMakeFiles/tm.dir/simpletransportcrosssection.C.o"
+  "CMakeFiles/tm.dir/simpletransportcrosssection.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
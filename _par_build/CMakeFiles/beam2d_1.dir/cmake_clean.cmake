@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/beam2d_1.dir/bindings/oofemlib/beam2d_1.C.o"
+  "CMakeFiles/beam2d_1.dir/bindings/oofemlib/beam2d_1.C.o.d"
+  "beam2d_1"
+  "beam2d_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/beam2d_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
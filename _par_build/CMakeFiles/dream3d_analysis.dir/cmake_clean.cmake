@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dream3d_analysis.dir/bindings/oofemlib/dream3d_analysis.C.o"
+  "CMakeFiles/dream3d_analysis.dir/bindings/oofemlib/dream3d_analysis.C.o.d"
+  "dream3d_analysis"
+  "dream3d_analysis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dream3d_analysis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,701 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_par_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(partest_bar "mpirun" "--oversubscribe" "-np" "4" "/root/repo/_par_build/oofem" "-p" "-f" "bar.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_bar PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/bar" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_barnl "mpirun" "--oversubscribe" "-np" "4" "/root/repo/_par_build/oofem" "-p" "-f" "barnl.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_barnl PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/barnl" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_barnl2 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "barnl2.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_barnl2 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/barnl2" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_brazil_2d_nl2 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "brazil_2d_nl2.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_brazil_2d_nl2 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/brazil_2d_nl2" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_brazil_2d_nl4 "mpirun" "--oversubscribe" "-np" "4" "/root/repo/_par_build/oofem" "-p" "-f" "brazil_2d_nl4.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_brazil_2d_nl4 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/brazil_2d_nl4" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_brazil_2d_nl7 "mpirun" "--oversubscribe" "-np" "7" "/root/repo/_par_build/oofem" "-p" "-f" "brazil_2d_nl7.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_brazil_2d_nl7 PROPERTIES  TIMEOUT "2500" WORKING_DIRECTORY "/root/repo/tests//partests/brazil_2d_nl7" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_brazil_3d_nl "mpirun" "--oversubscribe" "-np" "8" "/root/repo/_par_build/oofem" "-p" "-f" "brazil_3d_nl.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_brazil_3d_nl PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/brazil_3d_nl" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_dyn_bar01 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "dyn_bar01.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_dyn_bar01 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/dyn_bar01" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_dyn_bar02 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "dyn_bar02.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_dyn_bar02 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/dyn_bar02" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_dyn_bar03 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "dyn_bar03.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_dyn_bar03 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/dyn_bar03" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_dyn_barnl "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "dyn_barnl.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_dyn_barnl PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/dyn_barnl" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_lb01 "mpirun" "--oversubscribe" "-np" "2" "/root/repo/_par_build/oofem" "-p" "-f" "lb01.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_lb01 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/lb01" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_lb02 "mpirun" "--oversubscribe" "-np" "3" "/root/repo/_par_build/oofem" "-p" "-f" "lb02.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_lb02 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/lb02" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_lb03 "mpirun" "--oversubscribe" "-np" "3" "/root/repo/_par_build/oofem" "-p" "-f" "lb03.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_lb03 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/lb03" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(partest_planestress "mpirun" "--oversubscribe" "-np" "4" "/root/repo/_par_build/oofem" "-p" "-f" "planestress.oofem.in" "-ksp_type" "cg")
+set_tests_properties(partest_planestress PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//partests/planestress" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;776;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_DruckerPrager_01.in "/root/repo/_par_build/oofem" "-f" "DruckerPrager_01.in")
+set_tests_properties(test_sm_DruckerPrager_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_EC2creep.in "/root/repo/_par_build/oofem" "-f" "EC2creep.in")
+set_tests_properties(test_sm_EC2creep.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_EC2creep_casting.in "/root/repo/_par_build/oofem" "-f" "EC2creep_casting.in")
+set_tests_properties(test_sm_EC2creep_casting.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_EC2shrinkage.in "/root/repo/_par_build/oofem" "-f" "EC2shrinkage.in")
+set_tests_properties(test_sm_EC2shrinkage.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_Line1.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_Line1.in")
+set_tests_properties(test_sm_InterfaceEL_Line1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_Point2D_01.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_Point2D_01.in")
+set_tests_properties(test_sm_InterfaceEL_Point2D_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_Point3D_01.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_Point3D_01.in")
+set_tests_properties(test_sm_InterfaceEL_Point3D_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_Point3D_02.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_Point3D_02.in")
+set_tests_properties(test_sm_InterfaceEL_Point3D_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_Point3D_03.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_Point3D_03.in")
+set_tests_properties(test_sm_InterfaceEL_Point3D_03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_InterfaceEL_SurfTr1.in "/root/repo/_par_build/oofem" "-f" "InterfaceEL_SurfTr1.in")
+set_tests_properties(test_sm_InterfaceEL_SurfTr1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_MPS_01_casting_sm.in "/root/repo/_par_build/oofem" "-f" "MPS_01_casting_sm.in")
+set_tests_properties(test_sm_MPS_01_casting_sm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_MPS_01_sec_sm.in "/root/repo/_par_build/oofem" "-f" "MPS_01_sec_sm.in")
+set_tests_properties(test_sm_MPS_01_sec_sm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_MPS_01_sm.in "/root/repo/_par_build/oofem" "-f" "MPS_01_sm.in")
+set_tests_properties(test_sm_MPS_01_sm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_Mises01.in "/root/repo/_par_build/oofem" "-f" "Mises01.in")
+set_tests_properties(test_sm_Mises01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_adapt01.in "/root/repo/_par_build/oofem" "-f" "adapt01.in")
+set_tests_properties(test_sm_adapt01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_adapt02.in "/root/repo/_par_build/oofem" "-f" "adapt02.in")
+set_tests_properties(test_sm_adapt02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm01.in "/root/repo/_par_build/oofem" "-f" "axisymm01.in")
+set_tests_properties(test_sm_axisymm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm02.in "/root/repo/_par_build/oofem" "-f" "axisymm02.in")
+set_tests_properties(test_sm_axisymm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm03.in "/root/repo/_par_build/oofem" "-f" "axisymm03.in")
+set_tests_properties(test_sm_axisymm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm04.in "/root/repo/_par_build/oofem" "-f" "axisymm04.in")
+set_tests_properties(test_sm_axisymm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm05.in "/root/repo/_par_build/oofem" "-f" "axisymm05.in")
+set_tests_properties(test_sm_axisymm05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_axisymm06.in "/root/repo/_par_build/oofem" "-f" "axisymm06.in")
+set_tests_properties(test_sm_axisymm06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam2d_1.in "/root/repo/_par_build/oofem" "-f" "beam2d_1.in")
+set_tests_properties(test_sm_beam2d_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam2d_2.in "/root/repo/_par_build/oofem" "-f" "beam2d_2.in")
+set_tests_properties(test_sm_beam2d_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam2d_3.in "/root/repo/_par_build/oofem" "-f" "beam2d_3.in")
+set_tests_properties(test_sm_beam2d_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam2d_4.in "/root/repo/_par_build/oofem" "-f" "beam2d_4.in")
+set_tests_properties(test_sm_beam2d_4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam2d_5.in "/root/repo/_par_build/oofem" "-f" "beam2d_5.in")
+set_tests_properties(test_sm_beam2d_5.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_1.in "/root/repo/_par_build/oofem" "-f" "beam3d_1.in")
+set_tests_properties(test_sm_beam3d_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_2.in "/root/repo/_par_build/oofem" "-f" "beam3d_2.in")
+set_tests_properties(test_sm_beam3d_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_3.in "/root/repo/_par_build/oofem" "-f" "beam3d_3.in")
+set_tests_properties(test_sm_beam3d_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_rve_1.in "/root/repo/_par_build/oofem" "-f" "beam3d_rve_1.in")
+set_tests_properties(test_sm_beam3d_rve_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_rve_2.in "/root/repo/_par_build/oofem" "-f" "beam3d_rve_2.in")
+set_tests_properties(test_sm_beam3d_rve_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3d_rve_3.in "/root/repo/_par_build/oofem" "-f" "beam3d_rve_3.in")
+set_tests_properties(test_sm_beam3d_rve_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam3dsubsoil01.in "/root/repo/_par_build/oofem" "-f" "beam3dsubsoil01.in")
+set_tests_properties(test_sm_beam3dsubsoil01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_beam44.in "/root/repo/_par_build/oofem" "-f" "beam44.in")
+set_tests_properties(test_sm_beam44.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_bond_link_1.in "/root/repo/_par_build/oofem" "-f" "bond_link_1.in")
+set_tests_properties(test_sm_bond_link_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_bond_link_2.in "/root/repo/_par_build/oofem" "-f" "bond_link_2.in")
+set_tests_properties(test_sm_bond_link_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_bond_link_3.in "/root/repo/_par_build/oofem" "-f" "bond_link_3.in")
+set_tests_properties(test_sm_bond_link_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_bondceb01.in "/root/repo/_par_build/oofem" "-f" "bondceb01.in")
+set_tests_properties(test_sm_bondceb01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_bondceb02.in "/root/repo/_par_build/oofem" "-f" "bondceb02.in")
+set_tests_properties(test_sm_bondceb02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_1.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_1.in")
+set_tests_properties(test_sm_brick_nlgeo_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_2.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_2.in")
+set_tests_properties(test_sm_brick_nlgeo_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_3.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_3.in")
+set_tests_properties(test_sm_brick_nlgeo_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_4.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_4.in")
+set_tests_properties(test_sm_brick_nlgeo_4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_5.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_5.in")
+set_tests_properties(test_sm_brick_nlgeo_5.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_6.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_6.in")
+set_tests_properties(test_sm_brick_nlgeo_6.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_brick_nlgeo_7.in "/root/repo/_par_build/oofem" "-f" "brick_nlgeo_7.in")
+set_tests_properties(test_sm_brick_nlgeo_7.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_cantilever_Qspace.in "/root/repo/_par_build/oofem" "-f" "cantilever_Qspace.in")
+set_tests_properties(test_sm_cantilever_Qspace.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_compoDamMat.in "/root/repo/_par_build/oofem" "-f" "compoDamMat.in")
+set_tests_properties(test_sm_compoDamMat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con1dpm1.in "/root/repo/_par_build/oofem" "-f" "con1dpm1.in")
+set_tests_properties(test_sm_con1dpm1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con1dpm2.in "/root/repo/_par_build/oofem" "-f" "con1dpm2.in")
+set_tests_properties(test_sm_con1dpm2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con1dpm3.in "/root/repo/_par_build/oofem" "-f" "con1dpm3.in")
+set_tests_properties(test_sm_con1dpm3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm1.in "/root/repo/_par_build/oofem" "-f" "con2dpm1.in")
+set_tests_properties(test_sm_con2dpm1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm10.in "/root/repo/_par_build/oofem" "-f" "con2dpm10.in")
+set_tests_properties(test_sm_con2dpm10.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm11.in "/root/repo/_par_build/oofem" "-f" "con2dpm11.in")
+set_tests_properties(test_sm_con2dpm11.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm12.in "/root/repo/_par_build/oofem" "-f" "con2dpm12.in")
+set_tests_properties(test_sm_con2dpm12.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm2.in "/root/repo/_par_build/oofem" "-f" "con2dpm2.in")
+set_tests_properties(test_sm_con2dpm2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm3.in "/root/repo/_par_build/oofem" "-f" "con2dpm3.in")
+set_tests_properties(test_sm_con2dpm3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm4.in "/root/repo/_par_build/oofem" "-f" "con2dpm4.in")
+set_tests_properties(test_sm_con2dpm4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm5.in "/root/repo/_par_build/oofem" "-f" "con2dpm5.in")
+set_tests_properties(test_sm_con2dpm5.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm6.in "/root/repo/_par_build/oofem" "-f" "con2dpm6.in")
+set_tests_properties(test_sm_con2dpm6.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm7.in "/root/repo/_par_build/oofem" "-f" "con2dpm7.in")
+set_tests_properties(test_sm_con2dpm7.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm8.in "/root/repo/_par_build/oofem" "-f" "con2dpm8.in")
+set_tests_properties(test_sm_con2dpm8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_con2dpm9.in "/root/repo/_par_build/oofem" "-f" "con2dpm9.in")
+set_tests_properties(test_sm_con2dpm9.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_concrete_fcm_shear.in "/root/repo/_par_build/oofem" "-f" "concrete_fcm_shear.in")
+set_tests_properties(test_sm_concrete_fcm_shear.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_concrete_fcm_tension.in "/root/repo/_par_build/oofem" "-f" "concrete_fcm_tension.in")
+set_tests_properties(test_sm_concrete_fcm_tension.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_concrete_fcm_visco.in "/root/repo/_par_build/oofem" "-f" "concrete_fcm_visco.in")
+set_tests_properties(test_sm_concrete_fcm_visco.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_control_switch_1.in "/root/repo/_par_build/oofem" "-f" "control_switch_1.in")
+set_tests_properties(test_sm_control_switch_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_control_switch_2.in "/root/repo/_par_build/oofem" "-f" "control_switch_2.in")
+set_tests_properties(test_sm_control_switch_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_deactivate_1.in "/root/repo/_par_build/oofem" "-f" "deactivate_1.in")
+set_tests_properties(test_sm_deactivate_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_deactivate_2.in "/root/repo/_par_build/oofem" "-f" "deactivate_2.in")
+set_tests_properties(test_sm_deactivate_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_deadweight01.in "/root/repo/_par_build/oofem" "-f" "deadweight01.in")
+set_tests_properties(test_sm_deadweight01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_deadweight02.in "/root/repo/_par_build/oofem" "-f" "deadweight02.in")
+set_tests_properties(test_sm_deadweight02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_distancebasedaveraging.in "/root/repo/_par_build/oofem" "-f" "distancebasedaveraging.in")
+set_tests_properties(test_sm_distancebasedaveraging.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_dkt_bending01.in "/root/repo/_par_build/oofem" "-f" "dkt_bending01.in")
+set_tests_properties(test_sm_dkt_bending01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_dkt_rhombic_cantilever_4x4.in "/root/repo/_par_build/oofem" "-f" "dkt_rhombic_cantilever_4x4.in")
+set_tests_properties(test_sm_dkt_rhombic_cantilever_4x4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_dkt_rhombic_cantilever_4x4_mp.in "/root/repo/_par_build/oofem" "-f" "dkt_rhombic_cantilever_4x4_mp.in")
+set_tests_properties(test_sm_dkt_rhombic_cantilever_4x4_mp.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_dkt_twist01.in "/root/repo/_par_build/oofem" "-f" "dkt_twist01.in")
+set_tests_properties(test_sm_dkt_twist01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_dkt_twist02.in "/root/repo/_par_build/oofem" "-f" "dkt_twist02.in")
+set_tests_properties(test_sm_dkt_twist02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_eigen_beam2d.in "/root/repo/_par_build/oofem" "-f" "eigen_beam2d.in")
+set_tests_properties(test_sm_eigen_beam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_eigen_beam2d_lanczos.in "/root/repo/_par_build/oofem" "-f" "eigen_beam2d_lanczos.in")
+set_tests_properties(test_sm_eigen_beam2d_lanczos.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_eigen_beam3d.in "/root/repo/_par_build/oofem" "-f" "eigen_beam3d.in")
+set_tests_properties(test_sm_eigen_beam3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_eigenstrain01.in "/root/repo/_par_build/oofem" "-f" "eigenstrain01.in")
+set_tests_properties(test_sm_eigenstrain01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_eigenstrain02.in "/root/repo/_par_build/oofem" "-f" "eigenstrain02.in")
+set_tests_properties(test_sm_eigenstrain02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-01.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-01.in")
+set_tests_properties(test_sm_ex-bspline-01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-02.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-02.in")
+set_tests_properties(test_sm_ex-bspline-02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-03.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-03.in")
+set_tests_properties(test_sm_ex-bspline-03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-04.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-04.in")
+set_tests_properties(test_sm_ex-bspline-04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-05.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-05.in")
+set_tests_properties(test_sm_ex-bspline-05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-06.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-06.in")
+set_tests_properties(test_sm_ex-bspline-06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-07.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-07.in")
+set_tests_properties(test_sm_ex-bspline-07.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-08.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-08.in")
+set_tests_properties(test_sm_ex-bspline-08.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex-bspline-09.in "/root/repo/_par_build/oofem" "-f" "ex-bspline-09.in")
+set_tests_properties(test_sm_ex-bspline-09.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex3d-nurbs-01.in "/root/repo/_par_build/oofem" "-f" "ex3d-nurbs-01.in")
+set_tests_properties(test_sm_ex3d-nurbs-01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex3d-nurbs-02.in "/root/repo/_par_build/oofem" "-f" "ex3d-nurbs-02.in")
+set_tests_properties(test_sm_ex3d-nurbs-02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ex3d-nurbs-03.in "/root/repo/_par_build/oofem" "-f" "ex3d-nurbs-03.in")
+set_tests_properties(test_sm_ex3d-nurbs-03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_fe2structuralmaterial1.in "/root/repo/_par_build/oofem" "-f" "fe2structuralmaterial1.in")
+set_tests_properties(test_sm_fe2structuralmaterial1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_fe2structuralmaterial2.in "/root/repo/_par_build/oofem" "-f" "fe2structuralmaterial2.in")
+set_tests_properties(test_sm_fe2structuralmaterial2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_fe2structuralmaterial3.in "/root/repo/_par_build/oofem" "-f" "fe2structuralmaterial3.in")
+set_tests_properties(test_sm_fe2structuralmaterial3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_frcfcm_shear.in "/root/repo/_par_build/oofem" "-f" "frcfcm_shear.in")
+set_tests_properties(test_sm_frcfcm_shear.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_frcfcm_tension.in "/root/repo/_par_build/oofem" "-f" "frcfcm_tension.in")
+set_tests_properties(test_sm_frcfcm_tension.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_freewarpingtest2.in "/root/repo/_par_build/oofem" "-f" "freewarpingtest2.in")
+set_tests_properties(test_sm_freewarpingtest2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_hangingnode01.in "/root/repo/_par_build/oofem" "-f" "hangingnode01.in")
+set_tests_properties(test_sm_hangingnode01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_hangingnode02.in "/root/repo/_par_build/oofem" "-f" "hangingnode02.in")
+set_tests_properties(test_sm_hangingnode02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_hangingnode03.in "/root/repo/_par_build/oofem" "-f" "hangingnode03.in")
+set_tests_properties(test_sm_hangingnode03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_homog01.in "/root/repo/_par_build/oofem" "-f" "homog01.in")
+set_tests_properties(test_sm_homog01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_homog02.in "/root/repo/_par_build/oofem" "-f" "homog02.in")
+set_tests_properties(test_sm_homog02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_homog03.in "/root/repo/_par_build/oofem" "-f" "homog03.in")
+set_tests_properties(test_sm_homog03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_hyperelmat_ad.in "/root/repo/_par_build/oofem" "-f" "hyperelmat_ad.in")
+set_tests_properties(test_sm_hyperelmat_ad.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm01.in "/root/repo/_par_build/oofem" "-f" "idm01.in")
+set_tests_properties(test_sm_idm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm02.in "/root/repo/_par_build/oofem" "-f" "idm02.in")
+set_tests_properties(test_sm_idm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm03.in "/root/repo/_par_build/oofem" "-f" "idm03.in")
+set_tests_properties(test_sm_idm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm04.in "/root/repo/_par_build/oofem" "-f" "idm04.in")
+set_tests_properties(test_sm_idm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm05.in "/root/repo/_par_build/oofem" "-f" "idm05.in")
+set_tests_properties(test_sm_idm05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm06.in "/root/repo/_par_build/oofem" "-f" "idm06.in")
+set_tests_properties(test_sm_idm06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm07.in "/root/repo/_par_build/oofem" "-f" "idm07.in")
+set_tests_properties(test_sm_idm07.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_idm08.in "/root/repo/_par_build/oofem" "-f" "idm08.in")
+set_tests_properties(test_sm_idm08.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_incrlinstatic_isimposed.in "/root/repo/_par_build/oofem" "-f" "incrlinstatic_isimposed.in")
+set_tests_properties(test_sm_incrlinstatic_isimposed.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_interface01.in "/root/repo/_par_build/oofem" "-f" "interface01.in")
+set_tests_properties(test_sm_interface01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_interface3d.in "/root/repo/_par_build/oofem" "-f" "interface3d.in")
+set_tests_properties(test_sm_interface3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice2dboundary1.in "/root/repo/_par_build/oofem" "-f" "lattice2dboundary1.in")
+set_tests_properties(test_sm_lattice2dboundary1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice2drandom.in "/root/repo/_par_build/oofem" "-f" "lattice2drandom.in")
+set_tests_properties(test_sm_lattice2drandom.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3d1.in "/root/repo/_par_build/oofem" "-f" "lattice3d1.in")
+set_tests_properties(test_sm_lattice3d1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3d2.in "/root/repo/_par_build/oofem" "-f" "lattice3d2.in")
+set_tests_properties(test_sm_lattice3d2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3d3.in "/root/repo/_par_build/oofem" "-f" "lattice3d3.in")
+set_tests_properties(test_sm_lattice3d3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3d4.in "/root/repo/_par_build/oofem" "-f" "lattice3d4.in")
+set_tests_properties(test_sm_lattice3d4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3dbondplast1.in "/root/repo/_par_build/oofem" "-f" "lattice3dbondplast1.in")
+set_tests_properties(test_sm_lattice3dbondplast1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3dbondplast2.in "/root/repo/_par_build/oofem" "-f" "lattice3dbondplast2.in")
+set_tests_properties(test_sm_lattice3dbondplast2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3ddamplast1.in "/root/repo/_par_build/oofem" "-f" "lattice3ddamplast1.in")
+set_tests_properties(test_sm_lattice3ddamplast1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3ddamplast2.in "/root/repo/_par_build/oofem" "-f" "lattice3ddamplast2.in")
+set_tests_properties(test_sm_lattice3ddamplast2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3ddamplast3.in "/root/repo/_par_build/oofem" "-f" "lattice3ddamplast3.in")
+set_tests_properties(test_sm_lattice3ddamplast3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3delastic.in "/root/repo/_par_build/oofem" "-f" "lattice3delastic.in")
+set_tests_properties(test_sm_lattice3delastic.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lattice3drandom.in "/root/repo/_par_build/oofem" "-f" "lattice3drandom.in")
+set_tests_properties(test_sm_lattice3drandom.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_latticedamagevisco_mps_1.in "/root/repo/_par_build/oofem" "-f" "latticedamagevisco_mps_1.in")
+set_tests_properties(test_sm_latticedamagevisco_mps_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_latticelink1.in "/root/repo/_par_build/oofem" "-f" "latticelink1.in")
+set_tests_properties(test_sm_latticelink1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_latticeplastdamvisco_mps_1.in "/root/repo/_par_build/oofem" "-f" "latticeplastdamvisco_mps_1.in")
+set_tests_properties(test_sm_latticeplastdamvisco_mps_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_latticeviscoelastic_mps_1.in "/root/repo/_par_build/oofem" "-f" "latticeviscoelastic_mps_1.in")
+set_tests_properties(test_sm_latticeviscoelastic_mps_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_layered_cube.in "/root/repo/_par_build/oofem" "-f" "layered_cube.in")
+set_tests_properties(test_sm_layered_cube.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_layered_cube_lcs.in "/root/repo/_par_build/oofem" "-f" "layered_cube_lcs.in")
+set_tests_properties(test_sm_layered_cube_lcs.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_layered_libeam2d.in "/root/repo/_par_build/oofem" "-f" "layered_libeam2d.in")
+set_tests_properties(test_sm_layered_libeam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_libeam3dboundary.in "/root/repo/_par_build/oofem" "-f" "libeam3dboundary.in")
+set_tests_properties(test_sm_libeam3dboundary.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_libean3dnl.in "/root/repo/_par_build/oofem" "-f" "libean3dnl.in")
+set_tests_properties(test_sm_libean3dnl.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linear_constraint_1.in "/root/repo/_par_build/oofem" "-f" "linear_constraint_1.in")
+set_tests_properties(test_sm_linear_constraint_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linear_constraint_2.in "/root/repo/_par_build/oofem" "-f" "linear_constraint_2.in")
+set_tests_properties(test_sm_linear_constraint_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linear_constraint_3.in "/root/repo/_par_build/oofem" "-f" "linear_constraint_3.in")
+set_tests_properties(test_sm_linear_constraint_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linedistributedspring01.in "/root/repo/_par_build/oofem" "-f" "linedistributedspring01.in")
+set_tests_properties(test_sm_linedistributedspring01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linkslip01.in "/root/repo/_par_build/oofem" "-f" "linkslip01.in")
+set_tests_properties(test_sm_linkslip01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_linstab_beam2d.in "/root/repo/_par_build/oofem" "-f" "linstab_beam2d.in")
+set_tests_properties(test_sm_linstab_beam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_lshape.oofem.in "/root/repo/_par_build/oofem" "-f" "lshape.oofem.in")
+set_tests_properties(test_sm_lshape.oofem.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary01.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary01.in")
+set_tests_properties(test_sm_ltrspaceboundary01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary02.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary02.in")
+set_tests_properties(test_sm_ltrspaceboundary02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary03.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary03.in")
+set_tests_properties(test_sm_ltrspaceboundary03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary04.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary04.in")
+set_tests_properties(test_sm_ltrspaceboundary04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary05.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary05.in")
+set_tests_properties(test_sm_ltrspaceboundary05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_ltrspaceboundary06.in "/root/repo/_par_build/oofem" "-f" "ltrspaceboundary06.in")
+set_tests_properties(test_sm_ltrspaceboundary06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_macroLspace01.in "/root/repo/_par_build/oofem" "-f" "macroLspace01.in")
+set_tests_properties(test_sm_macroLspace01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_materOrient01.in "/root/repo/_par_build/oofem" "-f" "materOrient01.in")
+set_tests_properties(test_sm_materOrient01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_mooneyrivlin.in "/root/repo/_par_build/oofem" "-f" "mooneyrivlin.in")
+set_tests_properties(test_sm_mooneyrivlin.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_n2scontact01.in "/root/repo/_par_build/oofem" "-f" "n2scontact01.in")
+set_tests_properties(test_sm_n2scontact01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_n2scontact02.in "/root/repo/_par_build/oofem" "-f" "n2scontact02.in")
+set_tests_properties(test_sm_n2scontact02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_nldeidynamic_fast.in "/root/repo/_par_build/oofem" "-f" "nldeidynamic_fast.in")
+set_tests_properties(test_sm_nldeidynamic_fast.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_nldeidynamic_subcycling.in "/root/repo/_par_build/oofem" "-f" "nldeidynamic_subcycling.in")
+set_tests_properties(test_sm_nldeidynamic_subcycling.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_nodalspring01.in "/root/repo/_par_build/oofem" "-f" "nodalspring01.in")
+set_tests_properties(test_sm_nodalspring01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch010.in "/root/repo/_par_build/oofem" "-f" "patch010.in")
+set_tests_properties(test_sm_patch010.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch011.in "/root/repo/_par_build/oofem" "-f" "patch011.in")
+set_tests_properties(test_sm_patch011.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch100.in "/root/repo/_par_build/oofem" "-f" "patch100.in")
+set_tests_properties(test_sm_patch100.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch101.in "/root/repo/_par_build/oofem" "-f" "patch101.in")
+set_tests_properties(test_sm_patch101.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch102.in "/root/repo/_par_build/oofem" "-f" "patch102.in")
+set_tests_properties(test_sm_patch102.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch103.in "/root/repo/_par_build/oofem" "-f" "patch103.in")
+set_tests_properties(test_sm_patch103.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch104.in "/root/repo/_par_build/oofem" "-f" "patch104.in")
+set_tests_properties(test_sm_patch104.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch105.in "/root/repo/_par_build/oofem" "-f" "patch105.in")
+set_tests_properties(test_sm_patch105.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch106.in "/root/repo/_par_build/oofem" "-f" "patch106.in")
+set_tests_properties(test_sm_patch106.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch107.in "/root/repo/_par_build/oofem" "-f" "patch107.in")
+set_tests_properties(test_sm_patch107.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch108.in "/root/repo/_par_build/oofem" "-f" "patch108.in")
+set_tests_properties(test_sm_patch108.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch110.in "/root/repo/_par_build/oofem" "-f" "patch110.in")
+set_tests_properties(test_sm_patch110.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch130.in "/root/repo/_par_build/oofem" "-f" "patch130.in")
+set_tests_properties(test_sm_patch130.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch140.in "/root/repo/_par_build/oofem" "-f" "patch140.in")
+set_tests_properties(test_sm_patch140.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch150.in "/root/repo/_par_build/oofem" "-f" "patch150.in")
+set_tests_properties(test_sm_patch150.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch160.in "/root/repo/_par_build/oofem" "-f" "patch160.in")
+set_tests_properties(test_sm_patch160.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch200.in "/root/repo/_par_build/oofem" "-f" "patch200.in")
+set_tests_properties(test_sm_patch200.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch300.in "/root/repo/_par_build/oofem" "-f" "patch300.in")
+set_tests_properties(test_sm_patch300.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch301.in "/root/repo/_par_build/oofem" "-f" "patch301.in")
+set_tests_properties(test_sm_patch301.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch302.in "/root/repo/_par_build/oofem" "-f" "patch302.in")
+set_tests_properties(test_sm_patch302.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch303.in "/root/repo/_par_build/oofem" "-f" "patch303.in")
+set_tests_properties(test_sm_patch303.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_cct.in "/root/repo/_par_build/oofem" "-f" "patch_cct.in")
+set_tests_properties(test_sm_patch_cct.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_cct3d.in "/root/repo/_par_build/oofem" "-f" "patch_cct3d.in")
+set_tests_properties(test_sm_patch_cct3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_cct_02.in "/root/repo/_par_build/oofem" "-f" "patch_cct_02.in")
+set_tests_properties(test_sm_patch_cct_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_dkt.in "/root/repo/_par_build/oofem" "-f" "patch_dkt.in")
+set_tests_properties(test_sm_patch_dkt.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_mitc4.in "/root/repo/_par_build/oofem" "-f" "patch_mitc4.in")
+set_tests_properties(test_sm_patch_mitc4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_mitc4_02.in "/root/repo/_par_build/oofem" "-f" "patch_mitc4_02.in")
+set_tests_properties(test_sm_patch_mitc4_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_qdtk.in "/root/repo/_par_build/oofem" "-f" "patch_qdtk.in")
+set_tests_properties(test_sm_patch_qdtk.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_quad1mindlin.in "/root/repo/_par_build/oofem" "-f" "patch_quad1mindlin.in")
+set_tests_properties(test_sm_patch_quad1mindlin.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_patch_rershell.in "/root/repo/_par_build/oofem" "-f" "patch_rershell.in")
+set_tests_properties(test_sm_patch_rershell.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_planestress_j2.in "/root/repo/_par_build/oofem" "-f" "planestress_j2.in")
+set_tests_properties(test_sm_planestress_j2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_plasticRemap1.in "/root/repo/_par_build/oofem" "-f" "plasticRemap1.in")
+set_tests_properties(test_sm_plasticRemap1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_qTrxFemCrackVal.in "/root/repo/_par_build/oofem" "-f" "qTrxFemCrackVal.in")
+set_tests_properties(test_sm_qTrxFemCrackVal.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_quasicontinuum2d.in "/root/repo/_par_build/oofem" "-f" "quasicontinuum2d.in")
+set_tests_properties(test_sm_quasicontinuum2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_quasicontinuum3d.in "/root/repo/_par_build/oofem" "-f" "quasicontinuum3d.in")
+set_tests_properties(test_sm_quasicontinuum3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rigarm01.in "/root/repo/_par_build/oofem" "-f" "rigarm01.in")
+set_tests_properties(test_sm_rigarm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rigarm02.in "/root/repo/_par_build/oofem" "-f" "rigarm02.in")
+set_tests_properties(test_sm_rigarm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rigarm03.in "/root/repo/_par_build/oofem" "-f" "rigarm03.in")
+set_tests_properties(test_sm_rigarm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rigarm04.in "/root/repo/_par_build/oofem" "-f" "rigarm04.in")
+set_tests_properties(test_sm_rigarm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rigarm05.in "/root/repo/_par_build/oofem" "-f" "rigarm05.in")
+set_tests_properties(test_sm_rigarm05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rotated_1.in "/root/repo/_par_build/oofem" "-f" "rotated_1.in")
+set_tests_properties(test_sm_rotated_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_rotated_2.in "/root/repo/_par_build/oofem" "-f" "rotated_2.in")
+set_tests_properties(test_sm_rotated_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_scordelis_mitc4.in "/root/repo/_par_build/oofem" "-f" "scordelis_mitc4.in")
+set_tests_properties(test_sm_scordelis_mitc4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_slavedofs.in "/root/repo/_par_build/oofem" "-f" "slavedofs.in")
+set_tests_properties(test_sm_slavedofs.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring01.in "/root/repo/_par_build/oofem" "-f" "spring01.in")
+set_tests_properties(test_sm_spring01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring02.in "/root/repo/_par_build/oofem" "-f" "spring02.in")
+set_tests_properties(test_sm_spring02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring03.in "/root/repo/_par_build/oofem" "-f" "spring03.in")
+set_tests_properties(test_sm_spring03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring04.in "/root/repo/_par_build/oofem" "-f" "spring04.in")
+set_tests_properties(test_sm_spring04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring05.in "/root/repo/_par_build/oofem" "-f" "spring05.in")
+set_tests_properties(test_sm_spring05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_spring06.in "/root/repo/_par_build/oofem" "-f" "spring06.in")
+set_tests_properties(test_sm_spring06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_staggeredsolver.in "/root/repo/_par_build/oofem" "-f" "staggeredsolver.in")
+set_tests_properties(test_sm_staggeredsolver.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_steelRelaxMat.in "/root/repo/_par_build/oofem" "-f" "steelRelaxMat.in")
+set_tests_properties(test_sm_steelRelaxMat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_steelRelaxMat2.in "/root/repo/_par_build/oofem" "-f" "steelRelaxMat2.in")
+set_tests_properties(test_sm_steelRelaxMat2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_stressbasedaveraging.in "/root/repo/_par_build/oofem" "-f" "stressbasedaveraging.in")
+set_tests_properties(test_sm_stressbasedaveraging.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_structmateval.in "/root/repo/_par_build/oofem" "-f" "structmateval.in")
+set_tests_properties(test_sm_structmateval.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp1.in "/root/repo/_par_build/oofem" "-f" "test_wp1.in")
+set_tests_properties(test_sm_test_wp1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp2.in "/root/repo/_par_build/oofem" "-f" "test_wp2.in")
+set_tests_properties(test_sm_test_wp2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp3.in "/root/repo/_par_build/oofem" "-f" "test_wp3.in")
+set_tests_properties(test_sm_test_wp3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp4.in "/root/repo/_par_build/oofem" "-f" "test_wp4.in")
+set_tests_properties(test_sm_test_wp4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp5.in "/root/repo/_par_build/oofem" "-f" "test_wp5.in")
+set_tests_properties(test_sm_test_wp5.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_test_wp6.in "/root/repo/_par_build/oofem" "-f" "test_wp6.in")
+set_tests_properties(test_sm_test_wp6.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_trshell02_test.in "/root/repo/_par_build/oofem" "-f" "trshell02_test.in")
+set_tests_properties(test_sm_trshell02_test.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_truss2d_01.in "/root/repo/_par_build/oofem" "-f" "truss2d_01.in")
+set_tests_properties(test_sm_truss2d_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_trussb3_creep.in "/root/repo/_par_build/oofem" "-f" "trussb3_creep.in")
+set_tests_properties(test_sm_trussb3_creep.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_trussb3_relax.in "/root/repo/_par_build/oofem" "-f" "trussb3_relax.in")
+set_tests_properties(test_sm_trussb3_relax.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_tutorialelement.in "/root/repo/_par_build/oofem" "-f" "tutorialelement.in")
+set_tests_properties(test_sm_tutorialelement.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_tutorialmaterial.in "/root/repo/_par_build/oofem" "-f" "tutorialmaterial.in")
+set_tests_properties(test_sm_tutorialmaterial.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_vitrification01.in "/root/repo/_par_build/oofem" "-f" "vitrification01.in")
+set_tests_properties(test_sm_vitrification01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xFemCrackVal.in "/root/repo/_par_build/oofem" "-f" "xFemCrackVal.in")
+set_tests_properties(test_sm_xFemCrackVal.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xFemCrackValBranch.in "/root/repo/_par_build/oofem" "-f" "xFemCrackValBranch.in")
+set_tests_properties(test_sm_xFemCrackValBranch.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xFemCrackValBranchCZ.in "/root/repo/_par_build/oofem" "-f" "xFemCrackValBranchCZ.in")
+set_tests_properties(test_sm_xFemCrackValBranchCZ.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xFemIntersectingCracks.in "/root/repo/_par_build/oofem" "-f" "xFemIntersectingCracks.in")
+set_tests_properties(test_sm_xFemIntersectingCracks.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xfemCohesiveZone1.in "/root/repo/_par_build/oofem" "-f" "xfemCohesiveZone1.in")
+set_tests_properties(test_sm_xfemCohesiveZone1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xfemCrackPropMatForce.in "/root/repo/_par_build/oofem" "-f" "xfemCrackPropMatForce.in")
+set_tests_properties(test_sm_xfemCrackPropMatForce.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_xfemMultipleCracks1.in "/root/repo/_par_build/oofem" "-f" "xfemMultipleCracks1.in")
+set_tests_properties(test_sm_xfemMultipleCracks1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;786;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_context01.sh "bash" "context01.sh" "/root/repo/_par_build/oofem")
+set_tests_properties(test_sm_context01.sh PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;791;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_memoryusage01.sh "bash" "memoryusage01.sh" "/root/repo/_par_build/oofem")
+set_tests_properties(test_sm_memoryusage01.sh PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;791;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_sm_profiler01.sh "bash" "profiler01.sh" "/root/repo/_par_build/oofem")
+set_tests_properties(test_sm_profiler01.sh PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;791;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_smomp_threadsafety01.sh "bash" "threadsafety01.sh" "/root/repo/_par_build/oofem")
+set_tests_properties(test_smomp_threadsafety01.sh PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//smomp" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;810;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_HeMoKunzel_1.in "/root/repo/_par_build/oofem" "-f" "HeMoKunzel_1.in")
+set_tests_properties(test_tm_HeMoKunzel_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_TwoStepCasting_01.in "/root/repo/_par_build/oofem" "-f" "TwoStepCasting_01.in")
+set_tests_properties(test_tm_TwoStepCasting_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_bazantnajjar.in "/root/repo/_par_build/oofem" "-f" "bazantnajjar.in")
+set_tests_properties(test_tm_bazantnajjar.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat01.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat01.in")
+set_tests_properties(test_tm_hydratingConcreteMat01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat02.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat02.in")
+set_tests_properties(test_tm_hydratingConcreteMat02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat03.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat03.in")
+set_tests_properties(test_tm_hydratingConcreteMat03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat04.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat04.in")
+set_tests_properties(test_tm_hydratingConcreteMat04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat05.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat05.in")
+set_tests_properties(test_tm_hydratingConcreteMat05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_hydratingConcreteMat06.in "/root/repo/_par_build/oofem" "-f" "hydratingConcreteMat06.in")
+set_tests_properties(test_tm_hydratingConcreteMat06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_isolinmoisture.in "/root/repo/_par_build/oofem" "-f" "isolinmoisture.in")
+set_tests_properties(test_tm_isolinmoisture.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_lattice2dcrackinput.in "/root/repo/_par_build/oofem" "-f" "lattice2dcrackinput.in")
+set_tests_properties(test_tm_lattice2dcrackinput.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_lattice3d_mt1.in "/root/repo/_par_build/oofem" "-f" "lattice3d_mt1.in")
+set_tests_properties(test_tm_lattice3d_mt1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_latticetransmat.in "/root/repo/_par_build/oofem" "-f" "latticetransmat.in")
+set_tests_properties(test_tm_latticetransmat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_nlisomoisture01.in "/root/repo/_par_build/oofem" "-f" "nlisomoisture01.in")
+set_tests_properties(test_tm_nlisomoisture01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_nlisomoisture02.in "/root/repo/_par_build/oofem" "-f" "nlisomoisture02.in")
+set_tests_properties(test_tm_nlisomoisture02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_qbrick_01.in "/root/repo/_par_build/oofem" "-f" "qbrick_01.in")
+set_tests_properties(test_tm_qbrick_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_qbrick_02.in "/root/repo/_par_build/oofem" "-f" "qbrick_02.in")
+set_tests_properties(test_tm_qbrick_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_qbrick_03.in "/root/repo/_par_build/oofem" "-f" "qbrick_03.in")
+set_tests_properties(test_tm_qbrick_03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_qquad01.in "/root/repo/_par_build/oofem" "-f" "qquad01.in")
+set_tests_properties(test_tm_qquad01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_quadaxisym01.in "/root/repo/_par_build/oofem" "-f" "quadaxisym01.in")
+set_tests_properties(test_tm_quadaxisym01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_quadaxisym02.in "/root/repo/_par_build/oofem" "-f" "quadaxisym02.in")
+set_tests_properties(test_tm_quadaxisym02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_quadaxisym03.in "/root/repo/_par_build/oofem" "-f" "quadaxisym03.in")
+set_tests_properties(test_tm_quadaxisym03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_simpleDarcy.in "/root/repo/_par_build/oofem" "-f" "simpleDarcy.in")
+set_tests_properties(test_tm_simpleDarcy.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_simpleNonlinearDarcy.in "/root/repo/_par_build/oofem" "-f" "simpleNonlinearDarcy.in")
+set_tests_properties(test_tm_simpleNonlinearDarcy.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch01.in "/root/repo/_par_build/oofem" "-f" "tmpatch01.in")
+set_tests_properties(test_tm_tmpatch01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch02.in "/root/repo/_par_build/oofem" "-f" "tmpatch02.in")
+set_tests_properties(test_tm_tmpatch02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch03.in "/root/repo/_par_build/oofem" "-f" "tmpatch03.in")
+set_tests_properties(test_tm_tmpatch03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch04.in "/root/repo/_par_build/oofem" "-f" "tmpatch04.in")
+set_tests_properties(test_tm_tmpatch04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch05.in "/root/repo/_par_build/oofem" "-f" "tmpatch05.in")
+set_tests_properties(test_tm_tmpatch05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch06.in "/root/repo/_par_build/oofem" "-f" "tmpatch06.in")
+set_tests_properties(test_tm_tmpatch06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch07-8.in "/root/repo/_par_build/oofem" "-f" "tmpatch07-8.in")
+set_tests_properties(test_tm_tmpatch07-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch08-8.in "/root/repo/_par_build/oofem" "-f" "tmpatch08-8.in")
+set_tests_properties(test_tm_tmpatch08-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch11.in "/root/repo/_par_build/oofem" "-f" "tmpatch11.in")
+set_tests_properties(test_tm_tmpatch11.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch11dtf.in "/root/repo/_par_build/oofem" "-f" "tmpatch11dtf.in")
+set_tests_properties(test_tm_tmpatch11dtf.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch15.in "/root/repo/_par_build/oofem" "-f" "tmpatch15.in")
+set_tests_properties(test_tm_tmpatch15.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch16.in "/root/repo/_par_build/oofem" "-f" "tmpatch16.in")
+set_tests_properties(test_tm_tmpatch16.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch17.in "/root/repo/_par_build/oofem" "-f" "tmpatch17.in")
+set_tests_properties(test_tm_tmpatch17.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch20-8.in "/root/repo/_par_build/oofem" "-f" "tmpatch20-8.in")
+set_tests_properties(test_tm_tmpatch20-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch21-8.in "/root/repo/_par_build/oofem" "-f" "tmpatch21-8.in")
+set_tests_properties(test_tm_tmpatch21-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch31.in "/root/repo/_par_build/oofem" "-f" "tmpatch31.in")
+set_tests_properties(test_tm_tmpatch31.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch32.in "/root/repo/_par_build/oofem" "-f" "tmpatch32.in")
+set_tests_properties(test_tm_tmpatch32.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch33.in "/root/repo/_par_build/oofem" "-f" "tmpatch33.in")
+set_tests_properties(test_tm_tmpatch33.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch34.in "/root/repo/_par_build/oofem" "-f" "tmpatch34.in")
+set_tests_properties(test_tm_tmpatch34.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch35.in "/root/repo/_par_build/oofem" "-f" "tmpatch35.in")
+set_tests_properties(test_tm_tmpatch35.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch36.in "/root/repo/_par_build/oofem" "-f" "tmpatch36.in")
+set_tests_properties(test_tm_tmpatch36.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch37.in "/root/repo/_par_build/oofem" "-f" "tmpatch37.in")
+set_tests_properties(test_tm_tmpatch37.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch38.in "/root/repo/_par_build/oofem" "-f" "tmpatch38.in")
+set_tests_properties(test_tm_tmpatch38.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch39.in "/root/repo/_par_build/oofem" "-f" "tmpatch39.in")
+set_tests_properties(test_tm_tmpatch39.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch40.in "/root/repo/_par_build/oofem" "-f" "tmpatch40.in")
+set_tests_properties(test_tm_tmpatch40.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch41.in "/root/repo/_par_build/oofem" "-f" "tmpatch41.in")
+set_tests_properties(test_tm_tmpatch41.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch42.in "/root/repo/_par_build/oofem" "-f" "tmpatch42.in")
+set_tests_properties(test_tm_tmpatch42.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch43-1.in "/root/repo/_par_build/oofem" "-f" "tmpatch43-1.in")
+set_tests_properties(test_tm_tmpatch43-1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch43-2.in "/root/repo/_par_build/oofem" "-f" "tmpatch43-2.in")
+set_tests_properties(test_tm_tmpatch43-2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch43-3.in "/root/repo/_par_build/oofem" "-f" "tmpatch43-3.in")
+set_tests_properties(test_tm_tmpatch43-3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch44-1.in "/root/repo/_par_build/oofem" "-f" "tmpatch44-1.in")
+set_tests_properties(test_tm_tmpatch44-1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch44-2.in "/root/repo/_par_build/oofem" "-f" "tmpatch44-2.in")
+set_tests_properties(test_tm_tmpatch44-2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch44-3.in "/root/repo/_par_build/oofem" "-f" "tmpatch44-3.in")
+set_tests_properties(test_tm_tmpatch44-3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch45-1.in "/root/repo/_par_build/oofem" "-f" "tmpatch45-1.in")
+set_tests_properties(test_tm_tmpatch45-1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmpatch46.in "/root/repo/_par_build/oofem" "-f" "tmpatch46.in")
+set_tests_properties(test_tm_tmpatch46.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tm_tmquad12.in "/root/repo/_par_build/oofem" "-f" "tmquad12.in")
+set_tests_properties(test_tm_tmquad12.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;833;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_02_casting_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_02_casting_tmsm.in")
+set_tests_properties(test_tmsm_MPS_02_casting_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_02_sec_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_02_sec_tmsm.in")
+set_tests_properties(test_tmsm_MPS_02_sec_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_02_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_02_tmsm.in")
+set_tests_properties(test_tmsm_MPS_02_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_03_sec_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_03_sec_tmsm.in")
+set_tests_properties(test_tmsm_MPS_03_sec_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_03_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_03_tmsm.in")
+set_tests_properties(test_tmsm_MPS_03_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_04_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_04_tmsm.in")
+set_tests_properties(test_tmsm_MPS_04_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_05_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_05_tmsm.in")
+set_tests_properties(test_tmsm_MPS_05_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_06_casting_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_06_casting_tmsm.in")
+set_tests_properties(test_tmsm_MPS_06_casting_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_06_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_06_tmsm.in")
+set_tests_properties(test_tmsm_MPS_06_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_block01_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_block01_tmsm.in")
+set_tests_properties(test_tmsm_MPS_block01_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_MPS_block02_tmsm.in "/root/repo/_par_build/oofem" "-f" "MPS_block02_tmsm.in")
+set_tests_properties(test_tmsm_MPS_block02_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_adapt01_tmsm.in "/root/repo/_par_build/oofem" "-f" "adapt01_tmsm.in")
+set_tests_properties(test_tmsm_adapt01_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_concretefcmviscoelastic_tmsm.in "/root/repo/_par_build/oofem" "-f" "concretefcmviscoelastic_tmsm.in")
+set_tests_properties(test_tmsm_concretefcmviscoelastic_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_concretefcmviscoelasticcasting_tmsm.in "/root/repo/_par_build/oofem" "-f" "concretefcmviscoelasticcasting_tmsm.in")
+set_tests_properties(test_tmsm_concretefcmviscoelasticcasting_tmsm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_nltrans_incr.in "/root/repo/_par_build/oofem" "-f" "nltrans_incr.in")
+set_tests_properties(test_tmsm_nltrans_incr.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_nltrans_nonlin.in "/root/repo/_par_build/oofem" "-f" "nltrans_nonlin.in")
+set_tests_properties(test_tmsm_nltrans_nonlin.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_nonstat_nonlin_01.in "/root/repo/_par_build/oofem" "-f" "nonstat_nonlin_01.in")
+set_tests_properties(test_tmsm_nonstat_nonlin_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_nonstat_nonlin_02.in "/root/repo/_par_build/oofem" "-f" "nonstat_nonlin_02.in")
+set_tests_properties(test_tmsm_nonstat_nonlin_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;840;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmsm_memoryusage_staggered01.sh "bash" "memoryusage_staggered01.sh" "/root/repo/_par_build/oofem")
+set_tests_properties(test_tmsm_memoryusage_staggered01.sh PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;845;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_concrete_3point.in "/root/repo/_par_build/oofem" "-f" "concrete_3point.in")
+set_tests_properties(benchmark_sm_concrete_3point.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_concrete_3point_direct.in "/root/repo/_par_build/oofem" "-f" "concrete_3point_direct.in")
+set_tests_properties(benchmark_sm_concrete_3point_direct.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_eigendyn_cct.in "/root/repo/_par_build/oofem" "-f" "eigendyn_cct.in")
+set_tests_properties(benchmark_sm_eigendyn_cct.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_frcfcmnl_tension.in "/root/repo/_par_build/oofem" "-f" "frcfcmnl_tension.in")
+set_tests_properties(benchmark_sm_frcfcmnl_tension.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_j2mat.in "/root/repo/_par_build/oofem" "-f" "j2mat.in")
+set_tests_properties(benchmark_sm_j2mat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_steel1.in "/root/repo/_par_build/oofem" "-f" "steel1.in")
+set_tests_properties(benchmark_sm_steel1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_tr2Shell7XFEM_multicrack.in "/root/repo/_par_build/oofem" "-f" "tr2Shell7XFEM_multicrack.in")
+set_tests_properties(benchmark_sm_tr2Shell7XFEM_multicrack.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_tr2shell7.in "/root/repo/_par_build/oofem" "-f" "tr2shell7.in")
+set_tests_properties(benchmark_sm_tr2shell7.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_tr2shell7XFEM.in "/root/repo/_par_build/oofem" "-f" "tr2shell7XFEM.in")
+set_tests_properties(benchmark_sm_tr2shell7XFEM.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_sm_xfem01.in "/root/repo/_par_build/oofem" "-f" "xfem01.in")
+set_tests_properties(benchmark_sm_xfem01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests/benchmark/sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;892;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("src/oofemlib")
+subdirs("src/sm")
+subdirs("src/tm")
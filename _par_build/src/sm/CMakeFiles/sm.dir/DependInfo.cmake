@@ -0,0 +1,336 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sm/Contact/ActiveBc/node2nodelagrangianmultipliercontact.C" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2nodelagrangianmultipliercontact.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2nodelagrangianmultipliercontact.C.o.d"
+  "/root/repo/src/sm/Contact/ActiveBc/node2nodepenaltycontact.C" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2nodepenaltycontact.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2nodepenaltycontact.C.o.d"
+  "/root/repo/src/sm/Contact/ActiveBc/node2segmentpenaltycontact.C" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2segmentpenaltycontact.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Contact/ActiveBc/node2segmentpenaltycontact.C.o.d"
+  "/root/repo/src/sm/Contact/cdefnode2node.C" "src/sm/CMakeFiles/sm.dir/Contact/cdefnode2node.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Contact/cdefnode2node.C.o.d"
+  "/root/repo/src/sm/Contact/celnode2node.C" "src/sm/CMakeFiles/sm.dir/Contact/celnode2node.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Contact/celnode2node.C.o.d"
+  "/root/repo/src/sm/CrossSections/fiberedcs.C" "src/sm/CMakeFiles/sm.dir/CrossSections/fiberedcs.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/fiberedcs.C.o.d"
+  "/root/repo/src/sm/CrossSections/latticecrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/latticecrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/latticecrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/layeredcrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/layeredcrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/layeredcrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/simplecrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/simplecrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/simplecrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/structuralcrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/structuralcrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/structuralcrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/structuralinterfacecrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/structuralinterfacecrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/structuralinterfacecrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/variablecrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/variablecrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/variablecrosssection.C.o.d"
+  "/root/repo/src/sm/CrossSections/warpingcrosssection.C" "src/sm/CMakeFiles/sm.dir/CrossSections/warpingcrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/CrossSections/warpingcrosssection.C.o.d"
+  "/root/repo/src/sm/Deprecated/prescribedgenstrainshell7.C" "src/sm/CMakeFiles/sm.dir/Deprecated/prescribedgenstrainshell7.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Deprecated/prescribedgenstrainshell7.C.o.d"
+  "/root/repo/src/sm/Elements/3D/lspace.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/lspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/lspace.C.o.d"
+  "/root/repo/src/sm/Elements/3D/lspacebb.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/lspacebb.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/lspacebb.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspace.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspace.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundary.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundarybeam.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarybeam.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarybeam.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundarymembrane.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarymembrane.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarymembrane.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundaryplate.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryplate.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryplate.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundarytruss.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarytruss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarytruss.C.o.d"
+  "/root/repo/src/sm/Elements/3D/ltrspaceboundaryvoigt.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryvoigt.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryvoigt.C.o.d"
+  "/root/repo/src/sm/Elements/3D/lwedge.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/lwedge.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/lwedge.C.o.d"
+  "/root/repo/src/sm/Elements/3D/macrolspace.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/macrolspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/macrolspace.C.o.d"
+  "/root/repo/src/sm/Elements/3D/q27space.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/q27space.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/q27space.C.o.d"
+  "/root/repo/src/sm/Elements/3D/qspace.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/qspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/qspace.C.o.d"
+  "/root/repo/src/sm/Elements/3D/qtrspace.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/qtrspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/qtrspace.C.o.d"
+  "/root/repo/src/sm/Elements/3D/qwedge.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/qwedge.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/qwedge.C.o.d"
+  "/root/repo/src/sm/Elements/3D/space3delementevaluator.C" "src/sm/CMakeFiles/sm.dir/Elements/3D/space3delementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/3D/space3delementevaluator.C.o.d"
+  "/root/repo/src/sm/Elements/AbaqusUserElement.C" "src/sm/CMakeFiles/sm.dir/Elements/AbaqusUserElement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/AbaqusUserElement.C.o.d"
+  "/root/repo/src/sm/Elements/Axisymmetry/axisymm3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/axisymm3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/axisymm3d.C.o.d"
+  "/root/repo/src/sm/Elements/Axisymmetry/l4axisymm.C" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/l4axisymm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/l4axisymm.C.o.d"
+  "/root/repo/src/sm/Elements/Axisymmetry/q4axisymm.C" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/q4axisymm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Axisymmetry/q4axisymm.C.o.d"
+  "/root/repo/src/sm/Elements/Bars/qtruss1d.C" "src/sm/CMakeFiles/sm.dir/Elements/Bars/qtruss1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Bars/qtruss1d.C.o.d"
+  "/root/repo/src/sm/Elements/Bars/truss1d.C" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss1d.C.o.d"
+  "/root/repo/src/sm/Elements/Bars/truss2d.C" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss2d.C.o.d"
+  "/root/repo/src/sm/Elements/Bars/truss3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss3d.C.o.d"
+  "/root/repo/src/sm/Elements/Bars/truss3dnl.C" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss3dnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Bars/truss3dnl.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/beam2d.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beam2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beam2d.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/beam3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beam3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beam3d.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/beambaseelement.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beambaseelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/beambaseelement.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam2d.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam2d.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam2dnl.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam2dnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam2dnl.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3d.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3d2.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3d2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3d2.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundary.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundarybeam.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarybeam.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarybeam.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundarymembrane.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarymembrane.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarymembrane.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundaryplate.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryplate.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryplate.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundarytruss.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarytruss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarytruss.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dboundaryvoigt.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryvoigt.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryvoigt.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dnl.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dnl.C.o.d"
+  "/root/repo/src/sm/Elements/Beams/libeam3dnl2.C" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dnl2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Beams/libeam3dnl2.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/3D/qspacegraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qspacegraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qspacegraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/3D/qtrspacegraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qtrspacegraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qtrspacegraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/3D/qwedgegraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qwedgegraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/3D/qwedgegraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/Bars/qtruss1dgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/Bars/qtruss1dgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/Bars/qtruss1dgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/Bars/truss1dgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/Bars/truss1dgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/Bars/truss1dgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStrain/qplanestraingraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qplanestraingraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qplanestraingraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStrain/qtrplanestraingraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qtrplanestraingraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qtrplanestraingraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStrain/quad1planestraingraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/quad1planestraingraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/quad1planestraingraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStress/planestressgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/planestressgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/planestressgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStress/qplanestressgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qplanestressgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qplanestressgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStress/qtrplstrgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qtrplstrgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qtrplstrgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/PlaneStress/trplstrgraddamage.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/trplstrgraddamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/trplstrgraddamage.C.o.d"
+  "/root/repo/src/sm/Elements/GradientDamage/graddamageelement.C" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/graddamageelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/GradientDamage/graddamageelement.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/Deprecated/interfaceelem2dlin.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dlin.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/Deprecated/interfaceelem2dquad.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dquad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dquad.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/Deprecated/interfaceelem3dtrlin.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem3dtrlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem3dtrlin.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/Deprecated/interfaceelement1d.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelement1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelement1d.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/bondlink3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/bondlink3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/bondlink3d.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/bondlink3dboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/bondlink3dboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/bondlink3dboundary.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/cohsur3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/cohsur3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/cohsur3d.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelline1.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline1.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelline1intpen.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline1intpen.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline1intpen.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelline2.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline2.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelline2intpen.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline2intpen.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelline2intpen.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelpoint.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelpoint.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelpoint.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/intelsurftr1.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelsurftr1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/intelsurftr1.C.o.d"
+  "/root/repo/src/sm/Elements/Interfaces/structuralinterfaceelement.C" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/structuralinterfaceelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Interfaces/structuralinterfaceelement.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/lattice2d.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice2d.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/lattice2dboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice2dboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice2dboundary.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/lattice3d.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice3d.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/lattice3dboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice3dboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/lattice3dboundary.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/latticelink3d.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3d.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/latticelink3dboundary.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3dboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3dboundary.C.o.d"
+  "/root/repo/src/sm/Elements/LatticeElements/latticestructuralelement.C" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticestructuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/LatticeElements/latticestructuralelement.C.o.d"
+  "/root/repo/src/sm/Elements/MixedPressure/PlaneStrain/qtrplanestrainp1.C" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/qtrplanestrainp1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/qtrplanestrainp1.C.o.d"
+  "/root/repo/src/sm/Elements/MixedPressure/PlaneStrain/quad1planestrainp1.C" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/quad1planestrainp1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/quad1planestrainp1.C.o.d"
+  "/root/repo/src/sm/Elements/MixedPressure/basemixedpressureelement.C" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/basemixedpressureelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/MixedPressure/basemixedpressureelement.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStrain/qplanestrain.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/qplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/qplanestrain.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStrain/qtrplanestrain.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/qtrplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/qtrplanestrain.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStrain/quad1planestrain.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/quad1planestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/quad1planestrain.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStrain/trplanestrain.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/trplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStrain/trplanestrain.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/basicelement.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/basicelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/basicelement.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/linquad3d_planestress.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/linquad3d_planestress.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/linquad3d_planestress.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/planestresselementevaluator.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planestresselementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planestresselementevaluator.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/planstrss.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planstrss.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/planstrssxfem.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planstrssxfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/planstrssxfem.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/q9planstrss.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/q9planstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/q9planstrss.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/qplanstrss.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qplanstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qplanstrss.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/qtrplanstrssxfem.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qtrplanstrssxfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qtrplanstrssxfem.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/qtrplstr.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qtrplstr.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/qtrplstr.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanestressrotallman.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanestressrotallman3d.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman3d.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanrot.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanrot3d.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot3d.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanstrss.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrss.C.o.d"
+  "/root/repo/src/sm/Elements/PlaneStress/trplanstrssxfem.C" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrssxfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrssxfem.C.o.d"
+  "/root/repo/src/sm/Elements/Plates/cct.C" "src/sm/CMakeFiles/sm.dir/Elements/Plates/cct.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Plates/cct.C.o.d"
+  "/root/repo/src/sm/Elements/Plates/dkt.C" "src/sm/CMakeFiles/sm.dir/Elements/Plates/dkt.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Plates/dkt.C.o.d"
+  "/root/repo/src/sm/Elements/Plates/dkt3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Plates/dkt3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Plates/dkt3d.C.o.d"
+  "/root/repo/src/sm/Elements/Plates/qdkt.C" "src/sm/CMakeFiles/sm.dir/Elements/Plates/qdkt.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Plates/qdkt.C.o.d"
+  "/root/repo/src/sm/Elements/Plates/quad1mindlin.C" "src/sm/CMakeFiles/sm.dir/Elements/Plates/quad1mindlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Plates/quad1mindlin.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/cct3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/cct3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/cct3d.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/mitc4.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/mitc4.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/mitc4.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/quad1mindlinshell3d.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/quad1mindlinshell3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/quad1mindlinshell3d.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/rershell.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/rershell.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/rershell.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/shell7base.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/shell7base.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/shell7base.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/shell7basexfem.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/shell7basexfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/shell7basexfem.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/tr2shell7.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr2shell7.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr2shell7.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/tr2shell7xfem.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr2shell7xfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr2shell7xfem.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/tr_shell01.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr_shell01.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr_shell01.C.o.d"
+  "/root/repo/src/sm/Elements/Shells/tr_shell02.C" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr_shell02.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/Shells/tr_shell02.C.o.d"
+  "/root/repo/src/sm/Elements/htselement.C" "src/sm/CMakeFiles/sm.dir/Elements/htselement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/htselement.C.o.d"
+  "/root/repo/src/sm/Elements/igaelements.C" "src/sm/CMakeFiles/sm.dir/Elements/igaelements.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/igaelements.C.o.d"
+  "/root/repo/src/sm/Elements/linedistributedspring.C" "src/sm/CMakeFiles/sm.dir/Elements/linedistributedspring.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/linedistributedspring.C.o.d"
+  "/root/repo/src/sm/Elements/lumpedmasselement.C" "src/sm/CMakeFiles/sm.dir/Elements/lumpedmasselement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/lumpedmasselement.C.o.d"
+  "/root/repo/src/sm/Elements/nlstructuralelement.C" "src/sm/CMakeFiles/sm.dir/Elements/nlstructuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/nlstructuralelement.C.o.d"
+  "/root/repo/src/sm/Elements/nodalspringelement.C" "src/sm/CMakeFiles/sm.dir/Elements/nodalspringelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/nodalspringelement.C.o.d"
+  "/root/repo/src/sm/Elements/quad1platesubsoil.C" "src/sm/CMakeFiles/sm.dir/Elements/quad1platesubsoil.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/quad1platesubsoil.C.o.d"
+  "/root/repo/src/sm/Elements/quad2platesubsoil.C" "src/sm/CMakeFiles/sm.dir/Elements/quad2platesubsoil.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/quad2platesubsoil.C.o.d"
+  "/root/repo/src/sm/Elements/springelement.C" "src/sm/CMakeFiles/sm.dir/Elements/springelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/springelement.C.o.d"
+  "/root/repo/src/sm/Elements/structural2delement.C" "src/sm/CMakeFiles/sm.dir/Elements/structural2delement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/structural2delement.C.o.d"
+  "/root/repo/src/sm/Elements/structural3delement.C" "src/sm/CMakeFiles/sm.dir/Elements/structural3delement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/structural3delement.C.o.d"
+  "/root/repo/src/sm/Elements/structuralelement.C" "src/sm/CMakeFiles/sm.dir/Elements/structuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/structuralelement.C.o.d"
+  "/root/repo/src/sm/Elements/structuralelementevaluator.C" "src/sm/CMakeFiles/sm.dir/Elements/structuralelementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/structuralelementevaluator.C.o.d"
+  "/root/repo/src/sm/Elements/tet21ghostsolid.C" "src/sm/CMakeFiles/sm.dir/Elements/tet21ghostsolid.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/tet21ghostsolid.C.o.d"
+  "/root/repo/src/sm/Elements/tria1platesubsoil.C" "src/sm/CMakeFiles/sm.dir/Elements/tria1platesubsoil.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/tria1platesubsoil.C.o.d"
+  "/root/repo/src/sm/Elements/tria2platesubsoil.C" "src/sm/CMakeFiles/sm.dir/Elements/tria2platesubsoil.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/tria2platesubsoil.C.o.d"
+  "/root/repo/src/sm/Elements/trwarp.C" "src/sm/CMakeFiles/sm.dir/Elements/trwarp.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Elements/trwarp.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/adaptlinearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/adaptlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/adaptlinearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/adaptnlinearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/adaptnlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/adaptnlinearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/deidynamic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/deidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/deidynamic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/diidynamic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/diidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/diidynamic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/eigenvaluedynamic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/eigenvaluedynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/eigenvaluedynamic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/freewarping.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/freewarping.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/freewarping.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/incrementallinearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/incrementallinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/incrementallinearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/linearstability.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/linearstability.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/linearstability.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/linearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/linearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/linearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/nldeidynamic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nldeidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nldeidynamic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/nlineardynamic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nlineardynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nlineardynamic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/nlinearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/nlinearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/qclinearstatic.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/qclinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/qclinearstatic.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/staticstructural.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/staticstructural.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/staticstructural.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/structengngmodel.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/structengngmodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/structengngmodel.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/structuralmaterialevaluator.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/structuralmaterialevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/structuralmaterialevaluator.C.o.d"
+  "/root/repo/src/sm/EngineeringModels/xfemsolverinterface.C" "src/sm/CMakeFiles/sm.dir/EngineeringModels/xfemsolverinterface.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/EngineeringModels/xfemsolverinterface.C.o.d"
+  "/root/repo/src/sm/ErrorEstimators/combinedzzsiee.C" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/combinedzzsiee.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/combinedzzsiee.C.o.d"
+  "/root/repo/src/sm/ErrorEstimators/directerrorindicatorrc.C" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/directerrorindicatorrc.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/directerrorindicatorrc.C.o.d"
+  "/root/repo/src/sm/ErrorEstimators/huertaerrorestimator.C" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/huertaerrorestimator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/huertaerrorestimator.C.o.d"
+  "/root/repo/src/sm/ErrorEstimators/scalarerrorindicator.C" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/scalarerrorindicator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/scalarerrorindicator.C.o.d"
+  "/root/repo/src/sm/ErrorEstimators/zzerrorestimator.C" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/zzerrorestimator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ErrorEstimators/zzerrorestimator.C.o.d"
+  "/root/repo/src/sm/FETISolver/fetiboundarydofman.C" "src/sm/CMakeFiles/sm.dir/FETISolver/fetiboundarydofman.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/FETISolver/fetiboundarydofman.C.o.d"
+  "/root/repo/src/sm/FETISolver/feticommunicator.C" "src/sm/CMakeFiles/sm.dir/FETISolver/feticommunicator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/FETISolver/feticommunicator.C.o.d"
+  "/root/repo/src/sm/FETISolver/fetisolver.C" "src/sm/CMakeFiles/sm.dir/FETISolver/fetisolver.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/FETISolver/fetisolver.C.o.d"
+  "/root/repo/src/sm/Loads/constantpressureload.C" "src/sm/CMakeFiles/sm.dir/Loads/constantpressureload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/constantpressureload.C.o.d"
+  "/root/repo/src/sm/Loads/foreigntempfieldload.C" "src/sm/CMakeFiles/sm.dir/Loads/foreigntempfieldload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/foreigntempfieldload.C.o.d"
+  "/root/repo/src/sm/Loads/rotatingboundary.C" "src/sm/CMakeFiles/sm.dir/Loads/rotatingboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/rotatingboundary.C.o.d"
+  "/root/repo/src/sm/Loads/structeigenstrainload.C" "src/sm/CMakeFiles/sm.dir/Loads/structeigenstrainload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/structeigenstrainload.C.o.d"
+  "/root/repo/src/sm/Loads/structtemperatureload.C" "src/sm/CMakeFiles/sm.dir/Loads/structtemperatureload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/structtemperatureload.C.o.d"
+  "/root/repo/src/sm/Loads/tf1.C" "src/sm/CMakeFiles/sm.dir/Loads/tf1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/tf1.C.o.d"
+  "/root/repo/src/sm/Loads/usrdeftempfield.C" "src/sm/CMakeFiles/sm.dir/Loads/usrdeftempfield.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Loads/usrdeftempfield.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbone3d.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbone3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbone3d.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabboneembed.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabboneembed.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabboneembed.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbonegrad3d.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonegrad3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonegrad3d.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbonematerial.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonematerial.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbonenl.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbonenl3d.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl3d.C.o.d"
+  "/root/repo/src/sm/Materials/BoneMaterials/trabbonenlembed.C" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenlembed.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenlembed.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/compodamagemat.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/compodamagemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/compodamagemat.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concrete2.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete2.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concrete3.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete3.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete3.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concretedpm.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concretedpm2.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm2.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concretefcm.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcm.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/concretefcmviscoelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcmviscoelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcmviscoelastic.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/frcfcm.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcm.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/frcfcmnl.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcmnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcmnl.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/idm1.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idm1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idm1.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/idmgrad.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmgrad.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/idmnl1.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmnl1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmnl1.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/mazarsmodel.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodel.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/mazarsmodelnl.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodelnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodelnl.C.o.d"
+  "/root/repo/src/sm/Materials/ConcreteMaterials/mplasticmaterial2.C" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mplasticmaterial2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ConcreteMaterials/mplasticmaterial2.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/Deprecated/isointerfacedamage01.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage01.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage01.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/Deprecated/isointerfacedamage02.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage02.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage02.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/Deprecated/simpleinterfacemat.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/simpleinterfacemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/simpleinterfacemat.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/bondceb.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/bondceb.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/bondceb.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/cohint.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/cohint.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/cohint.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatbilinczelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczelastic.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatbilinczfagerstrom.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstrom.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstrom.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatbilinczfagerstromrate.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstromrate.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstromrate.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatbilinczjansson.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczjansson.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczjansson.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatbilinearcz.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinearcz.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinearcz.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatcoulombcontact.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatcoulombcontact.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatcoulombcontact.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatdummycz.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatdummycz.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatdummycz.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatelastic.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatisodamage.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamage.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/intmatisodamagetable.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamagetable.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamagetable.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/linkslip.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/linkslip.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/linkslip.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/masonry02.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/masonry02.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/masonry02.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/mat_cebfip90.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/mat_cebfip90.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/mat_cebfip90.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/structuralinterfacematerial.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerial.C.o.d"
+  "/root/repo/src/sm/Materials/InterfaceMaterials/structuralinterfacematerialstatus.C" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerialstatus.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerialstatus.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticebondplasticity.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticebondplasticity.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticebondplasticity.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticedamage.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamage.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticedamageviscoelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamageviscoelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamageviscoelastic.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticelinearelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticelinearelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticelinearelastic.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticematstatus.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticematstatus.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticematstatus.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticeplasticitydamage.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamage.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamage.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticeplasticitydamageviscoelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamageviscoelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamageviscoelastic.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticeslip.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeslip.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeslip.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticestructuralmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticestructuralmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticestructuralmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/LatticeMaterials/latticeviscoelastic.C" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeviscoelastic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeviscoelastic.C.o.d"
+  "/root/repo/src/sm/Materials/MixedPressure/mixedpressurematerialextensioninterface.C" "src/sm/CMakeFiles/sm.dir/Materials/MixedPressure/mixedpressurematerialextensioninterface.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/MixedPressure/mixedpressurematerialextensioninterface.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/j2mplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/j2mplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/j2mplasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/j2plasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/j2plasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/j2plasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/mplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/mplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/mplasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/perfectlyplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/perfectlyplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/perfectlyplasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/plasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/plasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/plasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/rankinepm.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/rankinepm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/rankinepm.C.o.d"
+  "/root/repo/src/sm/Materials/Obsolete/steel1.C" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/steel1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/Obsolete/steel1.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/b3mat.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3mat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3mat.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/b3solidmat.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3solidmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3solidmat.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/cebfip78.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/cebfip78.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/cebfip78.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/doublepowerlaw.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/doublepowerlaw.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/doublepowerlaw.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/eurocode2creep.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/eurocode2creep.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/eurocode2creep.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/kelvinChM.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChM.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/kelvinChSolM.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChSolM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChSolM.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/maxwellChM.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/maxwellChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/maxwellChM.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/mps.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/mps.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/mps.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/mpsdammat.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/mpsdammat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/mpsdammat.C.o.d"
+  "/root/repo/src/sm/Materials/RheoChainMaterials/rheoChM.C" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/rheoChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/RheoChainMaterials/rheoChM.C.o.d"
+  "/root/repo/src/sm/Materials/abaqususermaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/abaqususermaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/abaqususermaterial.C.o.d"
+  "/root/repo/src/sm/Materials/anisodamagemodel.C" "src/sm/CMakeFiles/sm.dir/Materials/anisodamagemodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/anisodamagemodel.C.o.d"
+  "/root/repo/src/sm/Materials/anisolinearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/anisolinearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/anisolinearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/deformationtheorymaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/deformationtheorymaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/deformationtheorymaterial.C.o.d"
+  "/root/repo/src/sm/Materials/druckerPragerPlasticitySM.C" "src/sm/CMakeFiles/sm.dir/Materials/druckerPragerPlasticitySM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/druckerPragerPlasticitySM.C.o.d"
+  "/root/repo/src/sm/Materials/druckerpragercutmat.C" "src/sm/CMakeFiles/sm.dir/Materials/druckerpragercutmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/druckerpragercutmat.C.o.d"
+  "/root/repo/src/sm/Materials/dustmat.C" "src/sm/CMakeFiles/sm.dir/Materials/dustmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/dustmat.C.o.d"
+  "/root/repo/src/sm/Materials/fcm.C" "src/sm/CMakeFiles/sm.dir/Materials/fcm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/fcm.C.o.d"
+  "/root/repo/src/sm/Materials/graddamagematerialextensioninterface.C" "src/sm/CMakeFiles/sm.dir/Materials/graddamagematerialextensioninterface.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/graddamagematerialextensioninterface.C.o.d"
+  "/root/repo/src/sm/Materials/hyperelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/hyperelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/hyperelasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/isodamagemodel.C" "src/sm/CMakeFiles/sm.dir/Materials/isodamagemodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/isodamagemodel.C.o.d"
+  "/root/repo/src/sm/Materials/isolinearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/isolinearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/isolinearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/j2mat.C" "src/sm/CMakeFiles/sm.dir/Materials/j2mat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/j2mat.C.o.d"
+  "/root/repo/src/sm/Materials/linearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/linearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/linearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/lsmastermat.C" "src/sm/CMakeFiles/sm.dir/Materials/lsmastermat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/lsmastermat.C.o.d"
+  "/root/repo/src/sm/Materials/lsmastermatgrad.C" "src/sm/CMakeFiles/sm.dir/Materials/lsmastermatgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/lsmastermatgrad.C.o.d"
+  "/root/repo/src/sm/Materials/m4.C" "src/sm/CMakeFiles/sm.dir/Materials/m4.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/m4.C.o.d"
+  "/root/repo/src/sm/Materials/mdm.C" "src/sm/CMakeFiles/sm.dir/Materials/mdm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/mdm.C.o.d"
+  "/root/repo/src/sm/Materials/micromaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/micromaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/micromaterial.C.o.d"
+  "/root/repo/src/sm/Materials/microplane_m1.C" "src/sm/CMakeFiles/sm.dir/Materials/microplane_m1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/microplane_m1.C.o.d"
+  "/root/repo/src/sm/Materials/microplanematerial.C" "src/sm/CMakeFiles/sm.dir/Materials/microplanematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/microplanematerial.C.o.d"
+  "/root/repo/src/sm/Materials/microplanematerial_bazant.C" "src/sm/CMakeFiles/sm.dir/Materials/microplanematerial_bazant.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/microplanematerial_bazant.C.o.d"
+  "/root/repo/src/sm/Materials/misesmat.C" "src/sm/CMakeFiles/sm.dir/Materials/misesmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/misesmat.C.o.d"
+  "/root/repo/src/sm/Materials/misesmatgrad.C" "src/sm/CMakeFiles/sm.dir/Materials/misesmatgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/misesmatgrad.C.o.d"
+  "/root/repo/src/sm/Materials/misesmatnl.C" "src/sm/CMakeFiles/sm.dir/Materials/misesmatnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/misesmatnl.C.o.d"
+  "/root/repo/src/sm/Materials/mooneyrivlin.C" "src/sm/CMakeFiles/sm.dir/Materials/mooneyrivlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/mooneyrivlin.C.o.d"
+  "/root/repo/src/sm/Materials/ortholinearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/ortholinearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/ortholinearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/rankinemat.C" "src/sm/CMakeFiles/sm.dir/Materials/rankinemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rankinemat.C.o.d"
+  "/root/repo/src/sm/Materials/rankinematgrad.C" "src/sm/CMakeFiles/sm.dir/Materials/rankinematgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rankinematgrad.C.o.d"
+  "/root/repo/src/sm/Materials/rankinematnl.C" "src/sm/CMakeFiles/sm.dir/Materials/rankinematnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rankinematnl.C.o.d"
+  "/root/repo/src/sm/Materials/rcm2.C" "src/sm/CMakeFiles/sm.dir/Materials/rcm2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rcm2.C.o.d"
+  "/root/repo/src/sm/Materials/rcsd.C" "src/sm/CMakeFiles/sm.dir/Materials/rcsd.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rcsd.C.o.d"
+  "/root/repo/src/sm/Materials/rcsde.C" "src/sm/CMakeFiles/sm.dir/Materials/rcsde.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rcsde.C.o.d"
+  "/root/repo/src/sm/Materials/rcsdnl.C" "src/sm/CMakeFiles/sm.dir/Materials/rcsdnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/rcsdnl.C.o.d"
+  "/root/repo/src/sm/Materials/simplevitrificationmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/simplevitrificationmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/simplevitrificationmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/steelrelaxmat.C" "src/sm/CMakeFiles/sm.dir/Materials/steelrelaxmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/steelrelaxmat.C.o.d"
+  "/root/repo/src/sm/Materials/structmatsettable.C" "src/sm/CMakeFiles/sm.dir/Materials/structmatsettable.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/structmatsettable.C.o.d"
+  "/root/repo/src/sm/Materials/structuralfe2material.C" "src/sm/CMakeFiles/sm.dir/Materials/structuralfe2material.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/structuralfe2material.C.o.d"
+  "/root/repo/src/sm/Materials/structuralmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/structuralmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/structuralmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/structuralms.C" "src/sm/CMakeFiles/sm.dir/Materials/structuralms.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/structuralms.C.o.d"
+  "/root/repo/src/sm/Materials/tutorialmaterial.C" "src/sm/CMakeFiles/sm.dir/Materials/tutorialmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/tutorialmaterial.C.o.d"
+  "/root/repo/src/sm/Materials/winklermodel.C" "src/sm/CMakeFiles/sm.dir/Materials/winklermodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/winklermodel.C.o.d"
+  "/root/repo/src/sm/Materials/winklerpasternak.C" "src/sm/CMakeFiles/sm.dir/Materials/winklerpasternak.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Materials/winklerpasternak.C.o.d"
+  "/root/repo/src/sm/Quasicontinuum/fullsolveddomain.C" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/fullsolveddomain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/fullsolveddomain.C.o.d"
+  "/root/repo/src/sm/Quasicontinuum/geometrygenerator.C" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/geometrygenerator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/geometrygenerator.C.o.d"
+  "/root/repo/src/sm/Quasicontinuum/quasicontinuum.C" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuum.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuum.C.o.d"
+  "/root/repo/src/sm/Quasicontinuum/quasicontinuumnumberingscheme.C" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumnumberingscheme.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumnumberingscheme.C.o.d"
+  "/root/repo/src/sm/Quasicontinuum/quasicontinuumvtkxmlexportmodule.C" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumvtkxmlexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumvtkxmlexportmodule.C.o.d"
+  "/root/repo/src/sm/export/dmexportmodule.C" "src/sm/CMakeFiles/sm.dir/export/dmexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/export/dmexportmodule.C.o.d"
+  "/root/repo/src/sm/export/gnuplotexportmodule.C" "src/sm/CMakeFiles/sm.dir/export/gnuplotexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/export/gnuplotexportmodule.C.o.d"
+  "/root/repo/src/sm/export/poiexportmodule.C" "src/sm/CMakeFiles/sm.dir/export/poiexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/export/poiexportmodule.C.o.d"
+  "/root/repo/src/sm/gpinitmodule.C" "src/sm/CMakeFiles/sm.dir/gpinitmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/gpinitmodule.C.o.d"
+  "/root/repo/src/sm/mappers/primvarmapper.C" "src/sm/CMakeFiles/sm.dir/mappers/primvarmapper.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mappers/primvarmapper.C.o.d"
+  "/root/repo/src/sm/particle.C" "src/sm/CMakeFiles/sm.dir/particle.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/particle.C.o.d"
+  "/root/repo/src/sm/polylinenonlocalbarrier.C" "src/sm/CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o.d"
+  "/root/repo/src/sm/refinedelement.C" "src/sm/CMakeFiles/sm.dir/refinedelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/refinedelement.C.o.d"
+  "/root/repo/src/sm/refinedmesh.C" "src/sm/CMakeFiles/sm.dir/refinedmesh.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/refinedmesh.C.o.d"
+  "/root/repo/src/sm/strainvector.C" "src/sm/CMakeFiles/sm.dir/strainvector.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/strainvector.C.o.d"
+  "/root/repo/src/sm/stressstrainbasevector.C" "src/sm/CMakeFiles/sm.dir/stressstrainbasevector.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/stressstrainbasevector.C.o.d"
+  "/root/repo/src/sm/stressvector.C" "src/sm/CMakeFiles/sm.dir/stressvector.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/stressvector.C.o.d"
+  "/root/repo/src/sm/symmetrybarrier.C" "src/sm/CMakeFiles/sm.dir/symmetrybarrier.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/symmetrybarrier.C.o.d"
+  "/root/repo/src/sm/xfem/enrichmentitems/crack.C" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/crack.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/crack.C.o.d"
+  "/root/repo/src/sm/xfem/enrichmentitems/delamination.C" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/delamination.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/delamination.C.o.d"
+  "/root/repo/src/sm/xfem/enrichmentitems/shellcrack.C" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/shellcrack.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/enrichmentitems/shellcrack.C.o.d"
+  "/root/repo/src/sm/xfem/matforceevaluator.C" "src/sm/CMakeFiles/sm.dir/xfem/matforceevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/matforceevaluator.C.o.d"
+  "/root/repo/src/sm/xfem/nucleationcriteria/ncprincipalstrain.C" "src/sm/CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstrain.C.o.d"
+  "/root/repo/src/sm/xfem/nucleationcriteria/ncprincipalstress.C" "src/sm/CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstress.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstress.C.o.d"
+  "/root/repo/src/sm/xfem/propagationlaws/plczdamageradius.C" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plczdamageradius.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plczdamageradius.C.o.d"
+  "/root/repo/src/sm/xfem/propagationlaws/plhoopstresscirc.C" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plhoopstresscirc.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plhoopstresscirc.C.o.d"
+  "/root/repo/src/sm/xfem/propagationlaws/plmaterialforce.C" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plmaterialforce.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plmaterialforce.C.o.d"
+  "/root/repo/src/sm/xfem/propagationlaws/plprincipalstrain.C" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plprincipalstrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/propagationlaws/plprincipalstrain.C.o.d"
+  "/root/repo/src/sm/xfem/xfemstructuralelementinterface.C" "src/sm/CMakeFiles/sm.dir/xfem/xfemstructuralelementinterface.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/xfemstructuralelementinterface.C.o.d"
+  "/root/repo/src/sm/xfem/xfemstructuremanager.C" "src/sm/CMakeFiles/sm.dir/xfem/xfemstructuremanager.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfem/xfemstructuremanager.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,643 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2nodelagrangianmultipliercontact.C.o"
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2nodelagrangianmultipliercontact.C.o.d"
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2nodepenaltycontact.C.o"
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2nodepenaltycontact.C.o.d"
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2segmentpenaltycontact.C.o"
+  "CMakeFiles/sm.dir/Contact/ActiveBc/node2segmentpenaltycontact.C.o.d"
+  "CMakeFiles/sm.dir/Contact/cdefnode2node.C.o"
+  "CMakeFiles/sm.dir/Contact/cdefnode2node.C.o.d"
+  "CMakeFiles/sm.dir/Contact/celnode2node.C.o"
+  "CMakeFiles/sm.dir/Contact/celnode2node.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/fiberedcs.C.o"
+  "CMakeFiles/sm.dir/CrossSections/fiberedcs.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/latticecrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/latticecrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/layeredcrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/layeredcrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/simplecrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/simplecrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/structuralcrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/structuralcrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/structuralinterfacecrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/structuralinterfacecrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/variablecrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/variablecrosssection.C.o.d"
+  "CMakeFiles/sm.dir/CrossSections/warpingcrosssection.C.o"
+  "CMakeFiles/sm.dir/CrossSections/warpingcrosssection.C.o.d"
+  "CMakeFiles/sm.dir/Deprecated/prescribedgenstrainshell7.C.o"
+  "CMakeFiles/sm.dir/Deprecated/prescribedgenstrainshell7.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/lspace.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/lspace.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/lspacebb.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/lspacebb.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspace.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspace.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarybeam.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarybeam.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarymembrane.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarymembrane.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryplate.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryplate.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarytruss.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundarytruss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryvoigt.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/ltrspaceboundaryvoigt.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/lwedge.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/lwedge.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/macrolspace.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/macrolspace.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/q27space.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/q27space.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/qspace.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/qspace.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/qtrspace.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/qtrspace.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/qwedge.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/qwedge.C.o.d"
+  "CMakeFiles/sm.dir/Elements/3D/space3delementevaluator.C.o"
+  "CMakeFiles/sm.dir/Elements/3D/space3delementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/Elements/AbaqusUserElement.C.o"
+  "CMakeFiles/sm.dir/Elements/AbaqusUserElement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/axisymm3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/axisymm3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/l4axisymm.C.o"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/l4axisymm.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/q4axisymm.C.o"
+  "CMakeFiles/sm.dir/Elements/Axisymmetry/q4axisymm.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Bars/qtruss1d.C.o"
+  "CMakeFiles/sm.dir/Elements/Bars/qtruss1d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Bars/truss1d.C.o"
+  "CMakeFiles/sm.dir/Elements/Bars/truss1d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Bars/truss2d.C.o"
+  "CMakeFiles/sm.dir/Elements/Bars/truss2d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Bars/truss3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Bars/truss3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Bars/truss3dnl.C.o"
+  "CMakeFiles/sm.dir/Elements/Bars/truss3dnl.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/beam2d.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/beam2d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/beam3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/beam3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/beambaseelement.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/beambaseelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam2d.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam2d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam2dnl.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam2dnl.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3d2.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3d2.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarybeam.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarybeam.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarymembrane.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarymembrane.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryplate.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryplate.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarytruss.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundarytruss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryvoigt.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dboundaryvoigt.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dnl.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dnl.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dnl2.C.o"
+  "CMakeFiles/sm.dir/Elements/Beams/libeam3dnl2.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qspacegraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qspacegraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qtrspacegraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qtrspacegraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qwedgegraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/3D/qwedgegraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/Bars/qtruss1dgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/Bars/qtruss1dgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/Bars/truss1dgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/Bars/truss1dgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qplanestraingraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qplanestraingraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qtrplanestraingraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/qtrplanestraingraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/quad1planestraingraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStrain/quad1planestraingraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/planestressgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/planestressgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qplanestressgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qplanestressgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qtrplstrgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/qtrplstrgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/trplstrgraddamage.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/PlaneStress/trplstrgraddamage.C.o.d"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/graddamageelement.C.o"
+  "CMakeFiles/sm.dir/Elements/GradientDamage/graddamageelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dlin.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dlin.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dquad.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem2dquad.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem3dtrlin.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelem3dtrlin.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelement1d.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/Deprecated/interfaceelement1d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/bondlink3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/bondlink3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/bondlink3dboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/bondlink3dboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/cohsur3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/cohsur3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline1.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline1.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline1intpen.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline1intpen.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline2.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline2.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline2intpen.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelline2intpen.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelpoint.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelpoint.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelsurftr1.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/intelsurftr1.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Interfaces/structuralinterfaceelement.C.o"
+  "CMakeFiles/sm.dir/Elements/Interfaces/structuralinterfaceelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice2d.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice2d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice2dboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice2dboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice3d.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice3dboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/lattice3dboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3d.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3dboundary.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticelink3dboundary.C.o.d"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticestructuralelement.C.o"
+  "CMakeFiles/sm.dir/Elements/LatticeElements/latticestructuralelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/qtrplanestrainp1.C.o"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/qtrplanestrainp1.C.o.d"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/quad1planestrainp1.C.o"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/PlaneStrain/quad1planestrainp1.C.o.d"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/basemixedpressureelement.C.o"
+  "CMakeFiles/sm.dir/Elements/MixedPressure/basemixedpressureelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/qplanestrain.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/qplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/qtrplanestrain.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/qtrplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/quad1planestrain.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/quad1planestrain.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/trplanestrain.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStrain/trplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/basicelement.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/basicelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/linquad3d_planestress.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/linquad3d_planestress.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planestresselementevaluator.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planestresselementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planstrss.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planstrss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planstrssxfem.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/planstrssxfem.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/q9planstrss.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/q9planstrss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qplanstrss.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qplanstrss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qtrplanstrssxfem.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qtrplanstrssxfem.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qtrplstr.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/qtrplstr.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman3d.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanestressrotallman3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot3d.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanrot3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrss.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrss.C.o.d"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrssxfem.C.o"
+  "CMakeFiles/sm.dir/Elements/PlaneStress/trplanstrssxfem.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Plates/cct.C.o"
+  "CMakeFiles/sm.dir/Elements/Plates/cct.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Plates/dkt.C.o"
+  "CMakeFiles/sm.dir/Elements/Plates/dkt.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Plates/dkt3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Plates/dkt3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Plates/qdkt.C.o"
+  "CMakeFiles/sm.dir/Elements/Plates/qdkt.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Plates/quad1mindlin.C.o"
+  "CMakeFiles/sm.dir/Elements/Plates/quad1mindlin.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/cct3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/cct3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/mitc4.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/mitc4.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/quad1mindlinshell3d.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/quad1mindlinshell3d.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/rershell.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/rershell.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/shell7base.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/shell7base.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/shell7basexfem.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/shell7basexfem.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/tr2shell7.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/tr2shell7.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/tr2shell7xfem.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/tr2shell7xfem.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/tr_shell01.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/tr_shell01.C.o.d"
+  "CMakeFiles/sm.dir/Elements/Shells/tr_shell02.C.o"
+  "CMakeFiles/sm.dir/Elements/Shells/tr_shell02.C.o.d"
+  "CMakeFiles/sm.dir/Elements/htselement.C.o"
+  "CMakeFiles/sm.dir/Elements/htselement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/igaelements.C.o"
+  "CMakeFiles/sm.dir/Elements/igaelements.C.o.d"
+  "CMakeFiles/sm.dir/Elements/linedistributedspring.C.o"
+  "CMakeFiles/sm.dir/Elements/linedistributedspring.C.o.d"
+  "CMakeFiles/sm.dir/Elements/lumpedmasselement.C.o"
+  "CMakeFiles/sm.dir/Elements/lumpedmasselement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/nlstructuralelement.C.o"
+  "CMakeFiles/sm.dir/Elements/nlstructuralelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/nodalspringelement.C.o"
+  "CMakeFiles/sm.dir/Elements/nodalspringelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/quad1platesubsoil.C.o"
+  "CMakeFiles/sm.dir/Elements/quad1platesubsoil.C.o.d"
+  "CMakeFiles/sm.dir/Elements/quad2platesubsoil.C.o"
+  "CMakeFiles/sm.dir/Elements/quad2platesubsoil.C.o.d"
+  "CMakeFiles/sm.dir/Elements/springelement.C.o"
+  "CMakeFiles/sm.dir/Elements/springelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/structural2delement.C.o"
+  "CMakeFiles/sm.dir/Elements/structural2delement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/structural3delement.C.o"
+  "CMakeFiles/sm.dir/Elements/structural3delement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/structuralelement.C.o"
+  "CMakeFiles/sm.dir/Elements/structuralelement.C.o.d"
+  "CMakeFiles/sm.dir/Elements/structuralelementevaluator.C.o"
+  "CMakeFiles/sm.dir/Elements/structuralelementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/Elements/tet21ghostsolid.C.o"
+  "CMakeFiles/sm.dir/Elements/tet21ghostsolid.C.o.d"
+  "CMakeFiles/sm.dir/Elements/tria1platesubsoil.C.o"
+  "CMakeFiles/sm.dir/Elements/tria1platesubsoil.C.o.d"
+  "CMakeFiles/sm.dir/Elements/tria2platesubsoil.C.o"
+  "CMakeFiles/sm.dir/Elements/tria2platesubsoil.C.o.d"
+  "CMakeFiles/sm.dir/Elements/trwarp.C.o"
+  "CMakeFiles/sm.dir/Elements/trwarp.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/adaptlinearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/adaptlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/adaptnlinearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/adaptnlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/deidynamic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/deidynamic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/diidynamic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/diidynamic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/eigenvaluedynamic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/eigenvaluedynamic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/freewarping.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/freewarping.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/incrementallinearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/incrementallinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/linearstability.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/linearstability.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/linearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/linearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/nldeidynamic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/nldeidynamic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/nlineardynamic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/nlineardynamic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/nlinearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/nlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/qclinearstatic.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/qclinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/staticstructural.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/staticstructural.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/structengngmodel.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/structengngmodel.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/structuralmaterialevaluator.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/structuralmaterialevaluator.C.o.d"
+  "CMakeFiles/sm.dir/EngineeringModels/xfemsolverinterface.C.o"
+  "CMakeFiles/sm.dir/EngineeringModels/xfemsolverinterface.C.o.d"
+  "CMakeFiles/sm.dir/ErrorEstimators/combinedzzsiee.C.o"
+  "CMakeFiles/sm.dir/ErrorEstimators/combinedzzsiee.C.o.d"
+  "CMakeFiles/sm.dir/ErrorEstimators/directerrorindicatorrc.C.o"
+  "CMakeFiles/sm.dir/ErrorEstimators/directerrorindicatorrc.C.o.d"
+  "CMakeFiles/sm.dir/ErrorEstimators/huertaerrorestimator.C.o"
+  "CMakeFiles/sm.dir/ErrorEstimators/huertaerrorestimator.C.o.d"
+  "CMakeFiles/sm.dir/ErrorEstimators/scalarerrorindicator.C.o"
+  "CMakeFiles/sm.dir/ErrorEstimators/scalarerrorindicator.C.o.d"
+  "CMakeFiles/sm.dir/ErrorEstimators/zzerrorestimator.C.o"
+  "CMakeFiles/sm.dir/ErrorEstimators/zzerrorestimator.C.o.d"
+  "CMakeFiles/sm.dir/FETISolver/fetiboundarydofman.C.o"
+  "CMakeFiles/sm.dir/FETISolver/fetiboundarydofman.C.o.d"
+  "CMakeFiles/sm.dir/FETISolver/feticommunicator.C.o"
+  "CMakeFiles/sm.dir/FETISolver/feticommunicator.C.o.d"
+  "CMakeFiles/sm.dir/FETISolver/fetisolver.C.o"
+  "CMakeFiles/sm.dir/FETISolver/fetisolver.C.o.d"
+  "CMakeFiles/sm.dir/Loads/constantpressureload.C.o"
+  "CMakeFiles/sm.dir/Loads/constantpressureload.C.o.d"
+  "CMakeFiles/sm.dir/Loads/foreigntempfieldload.C.o"
+  "CMakeFiles/sm.dir/Loads/foreigntempfieldload.C.o.d"
+  "CMakeFiles/sm.dir/Loads/rotatingboundary.C.o"
+  "CMakeFiles/sm.dir/Loads/rotatingboundary.C.o.d"
+  "CMakeFiles/sm.dir/Loads/structeigenstrainload.C.o"
+  "CMakeFiles/sm.dir/Loads/structeigenstrainload.C.o.d"
+  "CMakeFiles/sm.dir/Loads/structtemperatureload.C.o"
+  "CMakeFiles/sm.dir/Loads/structtemperatureload.C.o.d"
+  "CMakeFiles/sm.dir/Loads/tf1.C.o"
+  "CMakeFiles/sm.dir/Loads/tf1.C.o.d"
+  "CMakeFiles/sm.dir/Loads/usrdeftempfield.C.o"
+  "CMakeFiles/sm.dir/Loads/usrdeftempfield.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbone3d.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbone3d.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabboneembed.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabboneembed.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonegrad3d.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonegrad3d.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonematerial.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonematerial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl3d.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenl3d.C.o.d"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenlembed.C.o"
+  "CMakeFiles/sm.dir/Materials/BoneMaterials/trabbonenlembed.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/compodamagemat.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/compodamagemat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete2.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete2.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete3.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concrete3.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm2.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretedpm2.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcm.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcmviscoelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/concretefcmviscoelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcm.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcmnl.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/frcfcmnl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idm1.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idm1.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmgrad.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmgrad.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmnl1.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/idmnl1.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodel.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodel.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodelnl.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mazarsmodelnl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mplasticmaterial2.C.o"
+  "CMakeFiles/sm.dir/Materials/ConcreteMaterials/mplasticmaterial2.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage01.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage01.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage02.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/isointerfacedamage02.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/simpleinterfacemat.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/Deprecated/simpleinterfacemat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/bondceb.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/bondceb.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/cohint.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/cohint.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstrom.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstrom.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstromrate.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczfagerstromrate.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczjansson.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinczjansson.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinearcz.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatbilinearcz.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatcoulombcontact.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatcoulombcontact.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatdummycz.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatdummycz.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamage.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamage.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamagetable.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/intmatisodamagetable.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/linkslip.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/linkslip.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/masonry02.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/masonry02.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/mat_cebfip90.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/mat_cebfip90.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerial.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerialstatus.C.o"
+  "CMakeFiles/sm.dir/Materials/InterfaceMaterials/structuralinterfacematerialstatus.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticebondplasticity.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticebondplasticity.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamage.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamage.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamageviscoelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticedamageviscoelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticelinearelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticelinearelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticematstatus.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticematstatus.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamage.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamage.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamageviscoelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeplasticitydamageviscoelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeslip.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeslip.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticestructuralmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticestructuralmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeviscoelastic.C.o"
+  "CMakeFiles/sm.dir/Materials/LatticeMaterials/latticeviscoelastic.C.o.d"
+  "CMakeFiles/sm.dir/Materials/MixedPressure/mixedpressurematerialextensioninterface.C.o"
+  "CMakeFiles/sm.dir/Materials/MixedPressure/mixedpressurematerialextensioninterface.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/j2mplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/j2mplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/j2plasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/j2plasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/mplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/mplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/perfectlyplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/perfectlyplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/plasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/plasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/rankinepm.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/rankinepm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/Obsolete/steel1.C.o"
+  "CMakeFiles/sm.dir/Materials/Obsolete/steel1.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3mat.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3mat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3solidmat.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/b3solidmat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/cebfip78.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/cebfip78.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/doublepowerlaw.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/doublepowerlaw.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/eurocode2creep.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/eurocode2creep.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChM.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChM.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChSolM.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/kelvinChSolM.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/maxwellChM.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/maxwellChM.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/mps.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/mps.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/mpsdammat.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/mpsdammat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/rheoChM.C.o"
+  "CMakeFiles/sm.dir/Materials/RheoChainMaterials/rheoChM.C.o.d"
+  "CMakeFiles/sm.dir/Materials/abaqususermaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/abaqususermaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/anisodamagemodel.C.o"
+  "CMakeFiles/sm.dir/Materials/anisodamagemodel.C.o.d"
+  "CMakeFiles/sm.dir/Materials/anisolinearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/anisolinearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/deformationtheorymaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/deformationtheorymaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/druckerPragerPlasticitySM.C.o"
+  "CMakeFiles/sm.dir/Materials/druckerPragerPlasticitySM.C.o.d"
+  "CMakeFiles/sm.dir/Materials/druckerpragercutmat.C.o"
+  "CMakeFiles/sm.dir/Materials/druckerpragercutmat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/dustmat.C.o"
+  "CMakeFiles/sm.dir/Materials/dustmat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/fcm.C.o"
+  "CMakeFiles/sm.dir/Materials/fcm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/graddamagematerialextensioninterface.C.o"
+  "CMakeFiles/sm.dir/Materials/graddamagematerialextensioninterface.C.o.d"
+  "CMakeFiles/sm.dir/Materials/hyperelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/hyperelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/isodamagemodel.C.o"
+  "CMakeFiles/sm.dir/Materials/isodamagemodel.C.o.d"
+  "CMakeFiles/sm.dir/Materials/isolinearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/isolinearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/j2mat.C.o"
+  "CMakeFiles/sm.dir/Materials/j2mat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/linearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/linearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/lsmastermat.C.o"
+  "CMakeFiles/sm.dir/Materials/lsmastermat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/lsmastermatgrad.C.o"
+  "CMakeFiles/sm.dir/Materials/lsmastermatgrad.C.o.d"
+  "CMakeFiles/sm.dir/Materials/m4.C.o"
+  "CMakeFiles/sm.dir/Materials/m4.C.o.d"
+  "CMakeFiles/sm.dir/Materials/mdm.C.o"
+  "CMakeFiles/sm.dir/Materials/mdm.C.o.d"
+  "CMakeFiles/sm.dir/Materials/micromaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/micromaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/microplane_m1.C.o"
+  "CMakeFiles/sm.dir/Materials/microplane_m1.C.o.d"
+  "CMakeFiles/sm.dir/Materials/microplanematerial.C.o"
+  "CMakeFiles/sm.dir/Materials/microplanematerial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/microplanematerial_bazant.C.o"
+  "CMakeFiles/sm.dir/Materials/microplanematerial_bazant.C.o.d"
+  "CMakeFiles/sm.dir/Materials/misesmat.C.o"
+  "CMakeFiles/sm.dir/Materials/misesmat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/misesmatgrad.C.o"
+  "CMakeFiles/sm.dir/Materials/misesmatgrad.C.o.d"
+  "CMakeFiles/sm.dir/Materials/misesmatnl.C.o"
+  "CMakeFiles/sm.dir/Materials/misesmatnl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/mooneyrivlin.C.o"
+  "CMakeFiles/sm.dir/Materials/mooneyrivlin.C.o.d"
+  "CMakeFiles/sm.dir/Materials/ortholinearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/ortholinearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rankinemat.C.o"
+  "CMakeFiles/sm.dir/Materials/rankinemat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rankinematgrad.C.o"
+  "CMakeFiles/sm.dir/Materials/rankinematgrad.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rankinematnl.C.o"
+  "CMakeFiles/sm.dir/Materials/rankinematnl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rcm2.C.o"
+  "CMakeFiles/sm.dir/Materials/rcm2.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rcsd.C.o"
+  "CMakeFiles/sm.dir/Materials/rcsd.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rcsde.C.o"
+  "CMakeFiles/sm.dir/Materials/rcsde.C.o.d"
+  "CMakeFiles/sm.dir/Materials/rcsdnl.C.o"
+  "CMakeFiles/sm.dir/Materials/rcsdnl.C.o.d"
+  "CMakeFiles/sm.dir/Materials/simplevitrificationmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/simplevitrificationmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/steelrelaxmat.C.o"
+  "CMakeFiles/sm.dir/Materials/steelrelaxmat.C.o.d"
+  "CMakeFiles/sm.dir/Materials/structmatsettable.C.o"
+  "CMakeFiles/sm.dir/Materials/structmatsettable.C.o.d"
+  "CMakeFiles/sm.dir/Materials/structuralfe2material.C.o"
+  "CMakeFiles/sm.dir/Materials/structuralfe2material.C.o.d"
+  "CMakeFiles/sm.dir/Materials/structuralmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/structuralmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/structuralms.C.o"
+  "CMakeFiles/sm.dir/Materials/structuralms.C.o.d"
+  "CMakeFiles/sm.dir/Materials/tutorialmaterial.C.o"
+  "CMakeFiles/sm.dir/Materials/tutorialmaterial.C.o.d"
+  "CMakeFiles/sm.dir/Materials/winklermodel.C.o"
+  "CMakeFiles/sm.dir/Materials/winklermodel.C.o.d"
+  "CMakeFiles/sm.dir/Materials/winklerpasternak.C.o"
+  "CMakeFiles/sm.dir/Materials/winklerpasternak.C.o.d"
+  "CMakeFiles/sm.dir/Quasicontinuum/fullsolveddomain.C.o"
+  "CMakeFiles/sm.dir/Quasicontinuum/fullsolveddomain.C.o.d"
+  "CMakeFiles/sm.dir/Quasicontinuum/geometrygenerator.C.o"
+  "CMakeFiles/sm.dir/Quasicontinuum/geometrygenerator.C.o.d"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuum.C.o"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuum.C.o.d"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumnumberingscheme.C.o"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumnumberingscheme.C.o.d"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumvtkxmlexportmodule.C.o"
+  "CMakeFiles/sm.dir/Quasicontinuum/quasicontinuumvtkxmlexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/export/dmexportmodule.C.o"
+  "CMakeFiles/sm.dir/export/dmexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/export/gnuplotexportmodule.C.o"
+  "CMakeFiles/sm.dir/export/gnuplotexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/export/poiexportmodule.C.o"
+  "CMakeFiles/sm.dir/export/poiexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/gpinitmodule.C.o"
+  "CMakeFiles/sm.dir/gpinitmodule.C.o.d"
+  "CMakeFiles/sm.dir/mappers/primvarmapper.C.o"
+  "CMakeFiles/sm.dir/mappers/primvarmapper.C.o.d"
+  "CMakeFiles/sm.dir/particle.C.o"
+  "CMakeFiles/sm.dir/particle.C.o.d"
+  "CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o"
+  "CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o.d"
+  "CMakeFiles/sm.dir/refinedelement.C.o"
+  "CMakeFiles/sm.dir/refinedelement.C.o.d"
+  "CMakeFiles/sm.dir/refinedmesh.C.o"
+  "CMakeFiles/sm.dir/refinedmesh.C.o.d"
+  "CMakeFiles/sm.dir/strainvector.C.o"
+  "CMakeFiles/sm.dir/strainvector.C.o.d"
+  "CMakeFiles/sm.dir/stressstrainbasevector.C.o"
+  "CMakeFiles/sm.dir/stressstrainbasevector.C.o.d"
+  "CMakeFiles/sm.dir/stressvector.C.o"
+  "CMakeFiles/sm.dir/stressvector.C.o.d"
+  "CMakeFiles/sm.dir/symmetrybarrier.C.o"
+  "CMakeFiles/sm.dir/symmetrybarrier.C.o.d"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/crack.C.o"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/crack.C.o.d"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/delamination.C.o"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/delamination.C.o.d"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/shellcrack.C.o"
+  "CMakeFiles/sm.dir/xfem/enrichmentitems/shellcrack.C.o.d"
+  "CMakeFiles/sm.dir/xfem/matforceevaluator.C.o"
+  "CMakeFiles/sm.dir/xfem/matforceevaluator.C.o.d"
+  "CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstrain.C.o"
+  "CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstrain.C.o.d"
+  "CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstress.C.o"
+  "CMakeFiles/sm.dir/xfem/nucleationcriteria/ncprincipalstress.C.o.d"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plczdamageradius.C.o"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plczdamageradius.C.o.d"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plhoopstresscirc.C.o"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plhoopstresscirc.C.o.d"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plmaterialforce.C.o"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plmaterialforce.C.o.d"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plprincipalstrain.C.o"
+  "CMakeFiles/sm.dir/xfem/propagationlaws/plprincipalstrain.C.o.d"
+  "CMakeFiles/sm.dir/xfem/xfemstructuralelementinterface.C.o"
+  "CMakeFiles/sm.dir/xfem/xfemstructuralelementinterface.C.o.d"
+  "CMakeFiles/sm.dir/xfem/xfemstructuremanager.C.o"
+  "CMakeFiles/sm.dir/xfem/xfemstructuremanager.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()